@@ -0,0 +1,237 @@
+/*
+ * file: asset_pack.c
+ * ------------------
+ * Loader for the pre-baked asset pack, see asset_pack.h.
+ */
+#include "asset_pack.h"
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+        #define PACK_MMAP
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <fcntl.h>
+        #include <unistd.h>
+#endif
+
+bool map_pack_file(AssetPack* pack, const char* path);
+bool check_pack(AssetPack* pack);
+size_t pack_image_size(const PackEntry* entry);
+size_t pack_wave_size(const PackEntry* entry);
+
+
+bool open_asset_pack(AssetPack* pack, const char* path)
+{
+        pack->data = NULL;
+        pack->size = 0;
+        pack->entries = NULL;
+        pack->entry_count = 0;
+        pack->mapped = false;
+
+        if (!map_pack_file(pack, path)) {
+                unsigned int size = 0;
+                /* no mmap here, fall back to reading the whole file */
+                pack->data = LoadFileData(path, &size);
+                pack->size = size;
+        }
+        if (!pack->data)
+                return false;
+
+        if (!check_pack(pack)) {
+                TraceLog(LOG_WARNING, "PACK: [%s] Invalid asset pack", path);
+                close_asset_pack(pack);
+                return false;
+        }
+        return true;
+}
+
+
+void close_asset_pack(AssetPack* pack)
+{
+#ifdef PACK_MMAP
+        if (pack->mapped)
+                munmap(pack->data, pack->size);
+#endif
+        if (!pack->mapped)
+                UnloadFileData(pack->data);
+        pack->data = NULL;
+        pack->size = 0;
+        pack->entries = NULL;
+        pack->entry_count = 0;
+}
+
+
+bool map_pack_file(AssetPack* pack, const char* path)
+{
+#ifdef PACK_MMAP
+        struct stat info;
+        void* data;
+        int fd = open(path, O_RDONLY);
+
+        if (fd < 0)
+                return false;
+        if (fstat(fd, &info) != 0 || info.st_size == 0) {
+                close(fd);
+                return false;
+        }
+        data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        /* the mapping keeps its own reference to the file */
+        close(fd);
+        if (data == MAP_FAILED)
+                return false;
+
+        pack->data = data;
+        pack->size = info.st_size;
+        pack->mapped = true;
+        return true;
+#else
+        (void) pack;
+        (void) path;
+        return false;
+#endif
+}
+
+
+/* the header and every entry have to lie inside the file */
+bool check_pack(AssetPack* pack)
+{
+        const PackHeader* header = (const PackHeader*) pack->data;
+        size_t table_end;
+        unsigned int i;
+
+        if (pack->size < sizeof(PackHeader)
+        || header->magic != PACK_MAGIC
+        || header->version != PACK_VERSION)
+                return false;
+
+        table_end = sizeof(PackHeader) + (size_t) header->entry_count * sizeof(PackEntry);
+        if (table_end > pack->size)
+                return false;
+
+        pack->entries = (const PackEntry*) (pack->data + sizeof(PackHeader));
+        pack->entry_count = header->entry_count;
+
+        for (i = 0; i < pack->entry_count; i++) {
+                const PackEntry* entry = &pack->entries[i];
+                if ((size_t) entry->offset + entry->size > pack->size
+                || entry->name[PACK_NAME_SIZE - 1] != '\0')
+                        return false;
+        }
+        return true;
+}
+
+
+const PackEntry* find_pack_entry(AssetPack* pack, const char* name, PackEntryType type)
+{
+        unsigned int i;
+        for (i = 0; i < pack->entry_count; i++) {
+                const PackEntry* entry = &pack->entries[i];
+                if (entry->type == (unsigned int) type && strcmp(entry->name, name) == 0)
+                        return entry;
+        }
+        return NULL;
+}
+
+
+/* the image data points into the pack, it must not be unloaded or outlive it */
+bool get_pack_image(AssetPack* pack, const char* name, Image* image)
+{
+        const PackEntry* entry = find_pack_entry(pack, name, PACK_IMAGE);
+        size_t size;
+
+        if (!entry)
+                return false;
+        size = pack_image_size(entry);
+        if (size == 0 || entry->size < size)
+                return false;
+
+        image->data = pack->data + entry->offset;
+        image->width = entry->params[0];
+        image->height = entry->params[1];
+        image->format = entry->params[2];
+        image->mipmaps = entry->params[3];
+        return true;
+}
+
+
+/* the wave data points into the pack, it must not be unloaded or outlive it */
+bool get_pack_wave(AssetPack* pack, const char* name, Wave* wave)
+{
+        const PackEntry* entry = find_pack_entry(pack, name, PACK_WAVE);
+        size_t size;
+
+        if (!entry)
+                return false;
+        size = pack_wave_size(entry);
+        if (size == 0 || entry->size < size)
+                return false;
+
+        wave->data = pack->data + entry->offset;
+        wave->frameCount = entry->params[0];
+        wave->sampleRate = entry->params[1];
+        wave->sampleSize = entry->params[2];
+        wave->channels = entry->params[3];
+        return true;
+}
+
+
+/* bytes of the whole mip chain, 0 when the params can't describe a valid image */
+size_t pack_image_size(const PackEntry* entry)
+{
+        unsigned int width = entry->params[0];
+        unsigned int height = entry->params[1];
+        unsigned int format = entry->params[2];
+        unsigned int mipmaps = entry->params[3];
+        unsigned int max_mipmaps = 1;
+        size_t size = 0;
+        unsigned int i;
+
+        if (width == 0 || height == 0
+        || format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+        || format > PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)
+                return 0;
+        /* GetPixelDataSize() counts bits in an int, 128 for the widest format */
+        if ((size_t) width * height > INT_MAX / 128)
+                return 0;
+        while ((width | height) >> max_mipmaps)
+                max_mipmaps++;
+        if (mipmaps == 0 || mipmaps > max_mipmaps)
+                return 0;
+
+        for (i = 0; i < mipmaps; i++) {
+                size += GetPixelDataSize(width, height, format);
+                width = width > 1 ? width / 2 : 1;
+                height = height > 1 ? height / 2 : 1;
+        }
+        return size;
+}
+
+
+/* bytes of the interleaved samples, 0 when the params can't describe a valid wave */
+size_t pack_wave_size(const PackEntry* entry)
+{
+        unsigned long long samples = (unsigned long long) entry->params[0] * entry->params[3];
+        unsigned int sample_size = entry->params[2];
+
+        if (sample_size != 8 && sample_size != 16 && sample_size != 32)
+                return 0;
+        if (entry->params[3] == 0 || samples > SIZE_MAX / (sample_size / 8))
+                return 0;
+        return (size_t) samples * (sample_size / 8);
+}
+
+
+bool get_pack_rect(AssetPack* pack, const char* name, Rectangle* rect)
+{
+        const PackEntry* entry = find_pack_entry(pack, name, PACK_RECT);
+        if (!entry)
+                return false;
+
+        rect->x = entry->params[0];
+        rect->y = entry->params[1];
+        rect->width = entry->params[2];
+        rect->height = entry->params[3];
+        return true;
+}
@@ -0,0 +1,61 @@
+/*
+ * file: asset_pack.h
+ * ------------------
+ * Single file holding the game assets already decoded: RGBA texels ready for
+ * LoadTextureFromImage(), PCM ready for LoadSoundFromWave() and named
+ * rectangles into a packed atlas. The file is written by tools/pack_assets.c
+ * and mapped into memory at startup, entries point straight into the mapping
+ * so nothing is inflated, decoded or copied before reaching raylib.
+ *
+ * layout: PackHeader, entry_count PackEntry, then the entry data, every
+ * entry starting on a PACK_ALIGNMENT boundary.
+ */
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#define PACK_MAGIC 0x4b435043 /* "CPCK" */
+#define PACK_VERSION 1
+#define PACK_NAME_SIZE 32
+#define PACK_ALIGNMENT 64
+
+typedef enum {
+        PACK_IMAGE, /* params: width, height, format, mipmaps */
+        PACK_WAVE,  /* params: frame count, sample rate, sample size, channels */
+        PACK_RECT   /* params: x, y, width, height, no data */
+} PackEntryType;
+
+typedef struct {
+        unsigned int magic;
+        unsigned int version;
+        unsigned int entry_count;
+        unsigned int reserved;
+} PackHeader;
+
+typedef struct {
+        char name[PACK_NAME_SIZE];
+        unsigned int type;
+        unsigned int offset; /* from the start of the file */
+        unsigned int size;
+        unsigned int params[4];
+} PackEntry;
+
+typedef struct {
+        unsigned char* data;
+        size_t size;
+        const PackEntry* entries;
+        unsigned int entry_count;
+        bool mapped; /* false when the file was read into memory instead */
+} AssetPack;
+
+bool open_asset_pack(AssetPack* pack, const char* path);
+void close_asset_pack(AssetPack* pack);
+const PackEntry* find_pack_entry(AssetPack* pack, const char* name, PackEntryType type);
+bool get_pack_image(AssetPack* pack, const char* name, Image* image);
+bool get_pack_wave(AssetPack* pack, const char* name, Wave* wave);
+bool get_pack_rect(AssetPack* pack, const char* name, Rectangle* rect);
+
+#endif
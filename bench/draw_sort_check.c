@@ -0,0 +1,296 @@
+/*
+ * file: draw_sort_check.c
+ * -----------------------
+ * Renders the same scenes with rlgl draw sorting on and off into an
+ * offscreen framebuffer and checks the pixels match. The unsorted reference
+ * submits the draws layer by layer, the sorted run submits them shuffled
+ * and tagged with rlSetDrawLayer(). Fills outlined by lines on the same
+ * texture and textures merged into multi draws are both covered.
+ *
+ * Needs an OpenGL context without a window, taken from EGL (surfaceless
+ * Mesa works), and exits with 77 so ctest skips it when there is none.
+ *
+ * usage: cats_cradle_draw_sort_check_{gl33,es2} [subdata|orphan|persistent]
+ */
+#include <EGL/egl.h>                    /* before rlgl.h, glad redefines the khronos platform macros */
+#include <EGL/eglext.h>
+#define RLGL_IMPLEMENTATION
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define WIDTH 64
+#define HEIGHT 64
+#define SKIP_CODE 77
+
+typedef enum {
+        FILL,  /* RL_QUADS */
+        TRI,   /* RL_TRIANGLES */
+        FRAME  /* RL_LINES outline */
+} ShapeKind;
+
+typedef struct {
+        int layer;
+        ShapeKind kind;
+        int texture; /* 0 default, 1 and 2 the checker textures */
+        float x, y, w, h;
+        unsigned char color[4];
+} Shape;
+
+/* one layer: same texture draws overlapping in every mode, two textures that can merge */
+static const Shape flat_scene[] = {
+        { 0, FILL, 0, 4, 4, 24, 24, { 40, 80, 200, 255 } },
+        { 0, FRAME, 0, 4, 4, 24, 24, { 255, 255, 255, 255 } },
+        { 0, TRI, 0, 8, 8, 20, 20, { 220, 30, 30, 160 } },
+        { 0, FILL, 1, 36, 4, 8, 8, { 255, 255, 255, 255 } },
+        { 0, FILL, 2, 36, 20, 8, 8, { 255, 255, 255, 200 } },
+        { 0, FILL, 1, 48, 4, 8, 8, { 255, 255, 255, 255 } },
+        { 0, FRAME, 0, 6, 6, 20, 20, { 250, 220, 40, 255 } },
+        { 0, FILL, 0, 16, 16, 10, 10, { 30, 200, 60, 128 } }
+};
+
+/* submitted out of layer order, textures only overlap across layers (within one they may reorder) */
+static const Shape layered_scene[] = {
+        { 2, FRAME, 0, 4, 36, 24, 24, { 250, 220, 40, 255 } },
+        { 0, FILL, 1, 0, 32, 64, 32, { 255, 255, 255, 255 } },
+        { 1, FILL, 0, 8, 40, 16, 16, { 30, 200, 60, 128 } },
+        { 1, FILL, 2, 30, 40, 16, 16, { 255, 255, 255, 200 } },
+        { 2, TRI, 0, 32, 42, 12, 12, { 220, 30, 30, 160 } },
+        { 1, FRAME, 0, 2, 34, 60, 28, { 0, 0, 0, 255 } },
+        { 1, FILL, 1, 50, 36, 10, 10, { 255, 255, 255, 255 } }
+};
+
+static unsigned int textures[3];
+
+bool init_context(EGLDisplay* display);
+int parse_mode(int argc, char** argv);
+void load_textures(void);
+void draw_shape(const Shape* shape);
+unsigned char* render(const Shape* shapes, int count, bool sorted, int* draw_calls);
+bool check_scene(const char* name, const Shape* shapes, int count, bool fewer_calls);
+
+
+int main(int argc, char** argv)
+{
+        EGLDisplay display;
+        unsigned int fbo, color;
+        int mode = parse_mode(argc, argv);
+        bool ok;
+
+        if (mode < 0) {
+                fprintf(stderr, "usage: %s [subdata|orphan|persistent]\n", argv[0]);
+                return 1;
+        }
+        if (!init_context(&display)) {
+                printf("no EGL OpenGL context, skipped\n");
+                return SKIP_CODE;
+        }
+
+        rlLoadExtensions((void*) eglGetProcAddress);
+        rlSetRenderBatchStreaming(mode, 3);
+        rlglInit(WIDTH, HEIGHT);
+
+        fbo = rlLoadFramebuffer(WIDTH, HEIGHT);
+        color = rlLoadTexture(NULL, WIDTH, HEIGHT, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        rlFramebufferAttach(fbo, color, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        if (!rlFramebufferComplete(fbo)) {
+                printf("framebuffer incomplete\n");
+                return 1;
+        }
+        rlEnableFramebuffer(fbo);
+        rlViewport(0, 0, WIDTH, HEIGHT);
+        rlMatrixMode(RL_PROJECTION);
+        rlLoadIdentity();
+        rlOrtho(0, WIDTH, HEIGHT, 0, 0.0, 1.0);
+        rlMatrixMode(RL_MODELVIEW);
+        rlLoadIdentity();
+        load_textures();
+
+        ok = check_scene("flat", flat_scene, sizeof(flat_scene) / sizeof(flat_scene[0]), true);
+        ok = check_scene("layered", layered_scene, sizeof(layered_scene) / sizeof(layered_scene[0]), false) && ok;
+
+        rlUnloadTexture(textures[1]);
+        rlUnloadTexture(textures[2]);
+        rlDisableFramebuffer();
+        rlUnloadFramebuffer(fbo);
+        rlglClose();
+        eglTerminate(display);
+        return ok ? 0 : 1;
+}
+
+
+bool init_context(EGLDisplay* display)
+{
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        EGLint config_attribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT, EGL_NONE };
+        EGLint context_attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+        EGLenum api = EGL_OPENGL_ES_API;
+#else
+        EGLint config_attribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+        EGLint context_attribs[] = {
+                EGL_CONTEXT_MAJOR_VERSION, 3,
+                EGL_CONTEXT_MINOR_VERSION, 3,
+                EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                EGL_NONE
+        };
+        EGLenum api = EGL_OPENGL_API;
+#endif
+        EGLConfig config = EGL_NO_CONFIG_KHR;
+        EGLContext context;
+        EGLint config_count = 0;
+
+        /* no window system needed, the scenes are drawn to a framebuffer object */
+        *display = eglGetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        if (*display == EGL_NO_DISPLAY)
+                *display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (*display == EGL_NO_DISPLAY || !eglInitialize(*display, NULL, NULL))
+                return false;
+
+        /* surfaceless displays may list no configs, contexts are created without one then */
+        if (!eglBindAPI(api)
+        || !eglChooseConfig(*display, config_attribs, &config, 1, &config_count))
+                return false;
+        if (config_count == 0)
+                config = EGL_NO_CONFIG_KHR;
+
+        context = eglCreateContext(*display, config, EGL_NO_CONTEXT, context_attribs);
+        if (context == EGL_NO_CONTEXT)
+                return false;
+        return eglMakeCurrent(*display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+}
+
+
+int parse_mode(int argc, char** argv)
+{
+        if (argc < 2 || strcmp(argv[1], "subdata") == 0)
+                return RL_BATCH_STREAM_SUBDATA;
+        if (strcmp(argv[1], "orphan") == 0)
+                return RL_BATCH_STREAM_ORPHAN;
+        if (strcmp(argv[1], "persistent") == 0)
+                return RL_BATCH_STREAM_PERSISTENT;
+        return -1;
+}
+
+
+/* 2x2 checkers, nearest filtered so both tints show at the drawn size */
+void load_textures(void)
+{
+        unsigned char first[16] = { 255, 0, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255 };
+        unsigned char second[16] = { 0, 255, 255, 255, 0, 0, 255, 128, 0, 0, 255, 128, 0, 255, 255, 255 };
+        int i;
+
+        textures[0] = rlGetTextureIdDefault();
+        textures[1] = rlLoadTexture(first, 2, 2, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        textures[2] = rlLoadTexture(second, 2, 2, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        for (i = 1; i < 3; i++) {
+                rlTextureParameters(textures[i], RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(textures[i], RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+        }
+}
+
+
+/* the texture is always set, rlBegin() on the same mode would keep the last one */
+void draw_shape(const Shape* shape)
+{
+        float x1 = shape->x, y1 = shape->y;
+        float x2 = shape->x + shape->w, y2 = shape->y + shape->h;
+
+        rlSetTexture(textures[shape->texture]);
+        switch (shape->kind) {
+        case FILL:
+                rlBegin(RL_QUADS);
+                rlColor4ub(shape->color[0], shape->color[1], shape->color[2], shape->color[3]);
+                rlTexCoord2f(0, 0); rlVertex2f(x1, y1);
+                rlTexCoord2f(0, 1); rlVertex2f(x1, y2);
+                rlTexCoord2f(1, 1); rlVertex2f(x2, y2);
+                rlTexCoord2f(1, 0); rlVertex2f(x2, y1);
+                rlEnd();
+                break;
+        case TRI:
+                rlBegin(RL_TRIANGLES);
+                rlColor4ub(shape->color[0], shape->color[1], shape->color[2], shape->color[3]);
+                rlVertex2f(x1, y2);
+                rlVertex2f(x2, y2);
+                rlVertex2f((x1 + x2) / 2, y1);
+                rlEnd();
+                break;
+        case FRAME:
+                /* pixel centers, so the outline rasterizes the same on every driver */
+                x1 += 0.5f; y1 += 0.5f; x2 -= 0.5f; y2 -= 0.5f;
+                rlBegin(RL_LINES);
+                rlColor4ub(shape->color[0], shape->color[1], shape->color[2], shape->color[3]);
+                rlVertex2f(x1, y1); rlVertex2f(x2, y1);
+                rlVertex2f(x2, y1); rlVertex2f(x2, y2);
+                rlVertex2f(x2, y2); rlVertex2f(x1, y2);
+                rlVertex2f(x1, y2); rlVertex2f(x1, y1);
+                rlEnd();
+                break;
+        }
+        rlSetTexture(0);
+}
+
+
+/*
+ * unsorted draws go out layer by layer in submission order, the painter's
+ * order sorting has to reproduce; sorted draws go out as listed.
+ */
+unsigned char* render(const Shape* shapes, int count, bool sorted, int* draw_calls)
+{
+        int layer, i;
+
+        rlClearColor(0, 0, 0, 255);
+        rlClearScreenBuffers();
+        rlResetDrawStats();
+
+        if (sorted) {
+                rlEnableDrawSorting();
+                for (i = 0; i < count; i++) {
+                        rlSetDrawLayer(shapes[i].layer);
+                        draw_shape(&shapes[i]);
+                }
+                rlDrawRenderBatchActive();
+                rlDisableDrawSorting();
+        } else {
+                for (layer = 0; layer < 3; layer++) {
+                        for (i = 0; i < count; i++) {
+                                if (shapes[i].layer == layer)
+                                        draw_shape(&shapes[i]);
+                        }
+                }
+                rlDrawRenderBatchActive();
+        }
+
+        *draw_calls = rlGetDrawStats().drawCalls;
+        return rlReadScreenPixels(WIDTH, HEIGHT);
+}
+
+
+bool check_scene(const char* name, const Shape* shapes, int count, bool fewer_calls)
+{
+        int unsorted_calls, sorted_calls;
+        unsigned char* unsorted = render(shapes, count, false, &unsorted_calls);
+        unsigned char* sorted = render(shapes, count, true, &sorted_calls);
+        int differ = 0;
+        bool ok;
+        int i;
+
+        for (i = 0; i < WIDTH * HEIGHT; i++) {
+                differ += memcmp(unsorted + i * 4, sorted + i * 4, 4) != 0;
+        }
+        ok = differ == 0;
+#if defined(GRAPHICS_API_OPENGL_33)
+        /* merged draws only save calls with glMultiDraw*(), es2 issues one per range */
+        if (fewer_calls && sorted_calls >= unsorted_calls)
+                ok = false;
+#else
+        (void) fewer_calls;
+#endif
+
+        printf("%s: %d pixels differ, %d draw calls unsorted, %d sorted: %s\n",
+               name, differ, unsorted_calls, sorted_calls, ok ? "ok" : "FAILED");
+        RL_FREE(unsorted);
+        RL_FREE(sorted);
+        return ok;
+}
@@ -0,0 +1,157 @@
+/*
+ * file: headless.c
+ * ----------------
+ * Runs the simulation from game.c without a window, GPU or audio device and
+ * reports how fast a tick is for a few wave sizes. The cat follows a
+ * synthetic mouse path that keeps closing loops, the player can't die and a
+ * cleared wave is respawned right away so the enemy count stays put.
+ *
+ * usage: cats_cradle_bench [-t ticks] [wave ...]
+ */
+#define _POSIX_C_SOURCE 199309L
+#include "game.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define DEFAULT_TICKS 6000
+#define WARMUP_TICKS 240
+#define CAT_SIZE ((Vector2) { 64, 64 })     /* res/cat.png */
+#define ENEMY_SIZE ((Vector2) { 50, 37 })   /* res/mouse.png */
+
+static unsigned long allocations = 0;
+
+void* bench_realloc(void* ptr, size_t size);
+void bench_free(void* ptr);
+double now_seconds(void);
+Vector2 mouse_path(double t);
+int compare_doubles(const void* a, const void* b);
+void run_wave(unsigned int wave, unsigned int ticks);
+
+
+int main(int argc, char** argv)
+{
+        unsigned int default_waves[] = { 1, 10, 100, 400 };
+        unsigned int ticks = DEFAULT_TICKS;
+        unsigned int waves[64];
+        unsigned int wave_count = 0;
+        int i;
+
+        for (i = 1; i < argc; i++) {
+                if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+                        ticks = strtoul(argv[++i], NULL, 10);
+                else if (wave_count < sizeof(waves) / sizeof(waves[0]))
+                        waves[wave_count++] = strtoul(argv[i], NULL, 10);
+        }
+        if (ticks == 0) {
+                fprintf(stderr, "usage: %s [-t ticks] [wave ...]\n", argv[0]);
+                return 1;
+        }
+        if (wave_count == 0) {
+                wave_count = sizeof(default_waves) / sizeof(default_waves[0]);
+                memcpy(waves, default_waves, sizeof(default_waves));
+        }
+
+        printf("%6s %8s %12s %10s %10s %12s\n", "wave", "enemies", "ticks/s", "p50 us", "p99 us", "allocs/tick");
+        for (i = 0; i < (int) wave_count; i++) {
+                run_wave(waves[i], ticks);
+        }
+        return 0;
+}
+
+
+void* bench_realloc(void* ptr, size_t size)
+{
+        allocations++;
+        return realloc(ptr, size);
+}
+
+
+void bench_free(void* ptr)
+{
+        free(ptr);
+}
+
+
+double now_seconds(void)
+{
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+/* circles around the middle of the playfield with a slowly breathing radius */
+Vector2 mouse_path(double t)
+{
+        double radius = 150.0 + 120.0 * sin(t * 0.37);
+        double angle = t * 2.0 * PI * 0.8;
+        Vector2 pos = {
+                SCREEN_WIDTH / 2 + radius * cos(angle),
+                SCREEN_HEIGHT / 2 + radius * sin(angle)
+        };
+        return pos;
+}
+
+
+int compare_doubles(const void* a, const void* b)
+{
+        double x = *(const double*) a;
+        double y = *(const double*) b;
+        return (x > y) - (x < y);
+}
+
+
+void run_wave(unsigned int wave, unsigned int ticks)
+{
+        Game game;
+        double* latencies = malloc(ticks * sizeof(double));
+        unsigned int enemies = 5 + wave * 5;
+        unsigned long start_allocations = 0;
+        double total = 0;
+        unsigned int i;
+
+        if (!latencies) {
+                fprintf(stderr, "Memory Allocation Failed.\n");
+                exit(1);
+        }
+
+        srand(1);
+        init_game(&game, mouse_path(0), CAT_SIZE, ENEMY_SIZE, 1);
+        init_enemy_list(&game.enemy_list, 10);
+
+        for (i = 0; i < WARMUP_TICKS + ticks; i++) {
+                double start;
+                double elapsed;
+
+                if (game.enemy_list.size == 0) {
+                        game.wave.num = wave;
+                        spawn_wave(&game.enemy_list, &game.wave);
+                }
+                if (i == WARMUP_TICKS)
+                        start_allocations = allocations;
+
+                start = now_seconds();
+                update_game(&game, mouse_path(game.time + SIM_STEP));
+                elapsed = now_seconds() - start;
+
+                if (i >= WARMUP_TICKS) {
+                        latencies[i - WARMUP_TICKS] = elapsed;
+                        total += elapsed;
+                }
+        }
+
+        qsort(latencies, ticks, sizeof(double), compare_doubles);
+        printf("%6u %8u %12.0f %10.2f %10.2f %12.3f\n",
+               wave,
+               enemies,
+               ticks / total,
+               latencies[ticks / 2] * 1e6,
+               latencies[(unsigned int) (ticks * 0.99)] * 1e6,
+               (double) (allocations - start_allocations) / ticks);
+
+        free(latencies);
+        free_game(&game);
+}
@@ -0,0 +1,220 @@
+/*
+ * file: mix_exact.c
+ * -----------------
+ * Checks that the raudio mixing kernels give the same bits as the scalar
+ * loop they replaced: samplesOut[i] += samplesIn[i] * gains[i % 4], one
+ * input after another. Runs 1, 2, 3 and 6 channel layouts over odd frame
+ * counts and unaligned buffers, for single voices and batched pool voices.
+ * The SIMD path tested is the one raudio.c picks for the compiler flags, the
+ * AVX build of this file covers the AVX kernels on x86.
+ *
+ * usage: cats_cradle_mix_exact
+ */
+#include "raudio.c"
+
+#define MAX_FRAMES 1100
+#define MAX_CHANNELS 6
+#define MAX_INPUTS 5
+#define MAX_SAMPLES (MAX_FRAMES * MAX_CHANNELS)
+
+static unsigned int seed = 12345;
+
+float random_sample(void);
+void get_gains(unsigned int channels, float* gains);
+void mix_reference(float* out, const float* in, unsigned int count, const float* gains);
+bool check_samples(unsigned int channels, unsigned int frames, unsigned int offset);
+bool check_batch(unsigned int channels, unsigned int frames, unsigned int inputs);
+
+
+int main(void)
+{
+        unsigned int channels[] = { 1, 2, 3, 6 };
+        unsigned int frames[] = { 1, 2, 3, 5, 7, 8, 13, 31, 64, 255, 257, 1021, MAX_FRAMES - 1 };
+        unsigned int failures = 0;
+        unsigned int checks = 0;
+        unsigned int c, f, k;
+
+#if defined(RAUDIO_MIX_AVX)
+        printf("mix kernels: avx\n");
+#elif defined(RAUDIO_MIX_SSE2)
+        printf("mix kernels: sse2\n");
+#elif defined(RAUDIO_MIX_NEON)
+        printf("mix kernels: neon\n");
+#else
+        printf("mix kernels: scalar\n");
+#endif
+
+        for (c = 0; c < sizeof(channels) / sizeof(channels[0]); c++) {
+                for (f = 0; f < sizeof(frames) / sizeof(frames[0]); f++) {
+                        for (k = 0; k < 4; k++) {
+                                failures += !check_samples(channels[c], frames[f], k);
+                                checks++;
+                        }
+                        for (k = 1; k <= MAX_INPUTS; k++) {
+                                failures += !check_batch(channels[c], frames[f], k);
+                                checks++;
+                        }
+                }
+        }
+
+        printf("%u of %u checks bit exact\n", checks - failures, checks);
+        return failures == 0 ? 0 : 1;
+}
+
+
+/* uniform in [-1, 1), deterministic so a failure can be reproduced */
+float random_sample(void)
+{
+        seed = seed * 1664525u + 1013904223u;
+        return (float) (seed >> 8) / (float) (1 << 23) - 1.0f;
+}
+
+
+/* same patterns as GetAudioBufferGains(): pan law for stereo, volume otherwise */
+void get_gains(unsigned int channels, float* gains)
+{
+        float volume = 0.5f + 0.5f * random_sample();
+        int i;
+
+        if (channels == 2) {
+                float left = 0.5f + 0.5f * random_sample();
+                float right = 1.0f - left;
+                gains[0] = volume * 0.5f * left * (3.0f - left * left);
+                gains[1] = volume * 0.5f * right * (3.0f - right * right);
+                gains[2] = gains[0];
+                gains[3] = gains[1];
+        } else {
+                for (i = 0; i < 4; i++) {
+                        gains[i] = volume;
+                }
+        }
+}
+
+
+void mix_reference(float* out, const float* in, unsigned int count, const float* gains)
+{
+        unsigned int i;
+        for (i = 0; i < count; i++) {
+                out[i] += in[i] * gains[i % 4];
+        }
+}
+
+
+/* offset misaligns both buffers so the unaligned loads and stores get covered */
+bool check_samples(unsigned int channels, unsigned int frames, unsigned int offset)
+{
+        static float in[MAX_SAMPLES + 4];
+        static float out[MAX_SAMPLES + 4];
+        static float expected[MAX_SAMPLES + 4];
+        unsigned int count = frames * channels;
+        float gains[4];
+        unsigned int i;
+
+        get_gains(channels, gains);
+        for (i = 0; i < count; i++) {
+                in[offset + i] = random_sample();
+                out[offset + i] = random_sample();
+                expected[offset + i] = out[offset + i];
+        }
+
+        MixAudioSamples(out + offset, in + offset, count, gains);
+        mix_reference(expected + offset, in + offset, count, gains);
+
+        if (memcmp(out + offset, expected + offset, count * sizeof(float)) != 0) {
+                printf("MixAudioSamples: %u channels, %u frames, offset %u differs\n", channels, frames, offset);
+                return false;
+        }
+        return true;
+}
+
+
+/* the batch must match mixing every input on its own, in order */
+bool check_batch(unsigned int channels, unsigned int frames, unsigned int inputs)
+{
+        static float in[MAX_INPUTS][MAX_SAMPLES + 1];
+        static float out[MAX_SAMPLES];
+        static float expected[MAX_SAMPLES];
+        const float* in_ptrs[MAX_INPUTS];
+        unsigned int count = frames * channels;
+        float gains[4];
+        unsigned int i, k;
+
+        get_gains(channels, gains);
+        for (i = 0; i < count; i++) {
+                out[i] = random_sample();
+                expected[i] = out[i];
+        }
+        for (k = 0; k < inputs; k++) {
+                /* odd inputs start one sample in, voices rarely share an alignment */
+                in_ptrs[k] = in[k] + k % 2;
+                for (i = 0; i < count; i++) {
+                        in[k][k % 2 + i] = random_sample();
+                }
+        }
+
+        MixAudioSamplesBatch(out, in_ptrs, inputs, count, gains);
+        for (k = 0; k < inputs; k++) {
+                mix_reference(expected, in_ptrs[k], count, gains);
+        }
+
+        if (memcmp(out, expected, count * sizeof(float)) != 0) {
+                printf("MixAudioSamplesBatch: %u channels, %u frames, %u inputs differs\n", channels, frames, inputs);
+                return false;
+        }
+        return true;
+}
+
+
+/* raudio.c only needs these few raylib functions, none of them runs here */
+void TraceLog(int logLevel, const char* text, ...)
+{
+        (void) logLevel;
+        (void) text;
+}
+
+
+unsigned char* LoadFileData(const char* fileName, unsigned int* bytesRead)
+{
+        (void) fileName;
+        *bytesRead = 0;
+        return NULL;
+}
+
+
+bool SaveFileData(const char* fileName, void* data, unsigned int bytesToWrite)
+{
+        (void) fileName;
+        (void) data;
+        (void) bytesToWrite;
+        return false;
+}
+
+
+bool SaveFileText(const char* fileName, char* text)
+{
+        (void) fileName;
+        (void) text;
+        return false;
+}
+
+
+bool IsFileExtension(const char* fileName, const char* ext)
+{
+        (void) fileName;
+        (void) ext;
+        return false;
+}
+
+
+const char* GetFileExtension(const char* fileName)
+{
+        (void) fileName;
+        return "";
+}
+
+
+const char* GetFileNameWithoutExt(const char* filePath)
+{
+        (void) filePath;
+        return "";
+}
@@ -62,6 +62,8 @@
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING           1
+// Keep timings and draw counters of recent frames, see GetFrameStats()
+#define SUPPORT_FRAME_STATS             1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
@@ -87,6 +89,9 @@
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
 
+#define MAX_FRAME_STATS_HISTORY       300       // Maximum number of recent frames stats kept
+#define MAX_GIF_RECORD_QUEUE            4       // Maximum number of GIF frames waiting to be encoded
+
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
@@ -166,6 +171,10 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_IMAGE_BATCH_THREADS         8       // Maximum number of worker threads decoding an image batch
+
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -180,12 +189,17 @@
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
 #define SUPPORT_TEXT_MANIPULATION       1
+// Cache layouts of recently drawn strings, DrawTextEx() reuses them (GL thread only, MeasureTextEx() stays uncached)
+#define SUPPORT_TEXT_LAYOUT_CACHE       1
 
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define TEXT_FORMAT_ARENA_SIZE      16384       // Size of per-thread memory blocks used by TextFormatArena()
+#define MAX_TEXT_LAYOUT_CACHE          32       // Maximum number of text layouts cached
+#define MAX_TEXT_LAYOUT_CACHE_LENGTH  128       // Maximum text length cached, in bytes (including '\0')
 
 
 //------------------------------------------------------------------------------------
@@ -227,6 +241,9 @@
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
 
+// Measure the mixer callback: duration histogram, lock wait, buffers mixed and underruns, see GetAudioStats()
+#define SUPPORT_AUDIO_STATS                1
+
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
 //------------------------------------------------------------------------------------
@@ -180,6 +180,19 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+// Mixing kernels width, the scalar loop handles the remainder and is the fallback
+#if defined(__AVX__)
+    #include <immintrin.h>              // Required for: AVX mixing kernels [MixAudioSamples(), MixAudioSamplesBatch()]
+    #define RAUDIO_MIX_AVX
+    #define RAUDIO_MIX_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>              // Required for: SSE2 mixing kernels [MixAudioSamples(), MixAudioSamplesBatch()]
+    #define RAUDIO_MIX_SSE2
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>               // Required for: NEON mixing kernels [MixAudioSamples(), MixAudioSamplesBatch()]
+    #define RAUDIO_MIX_NEON
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -366,6 +379,23 @@ struct rAudioProcessor {
     rAudioProcessor *prev;          // Previous audio processor on the list
 };
 
+// Sound pool struct
+// NOTE: Play requests are counted atomically by any thread, voices are only touched by the mixer
+struct rAudioSoundPool {
+    rAudioBuffer *buffer;           // Shared sound buffer, already in device format
+    unsigned int frameCount;        // Sound frames to play
+    int voiceCount;                 // Number of voices
+    unsigned int *cursors;          // Voices frame cursor, frameCount or above when voice is free
+    const float **inputs;           // Voices data for batched mixing, scratch space for the mixer
+
+    ma_uint32 playRequests;         // Play requests counter, incremented without locking (atomic)
+    ma_uint32 playsStarted;         // Play requests already started by the mixer
+    ma_uint32 voicesPlaying;        // Voices playing at the last mix (atomic)
+
+    rAudioSoundPool *next;          // Next sound pool on the list
+    rAudioSoundPool *prev;          // Previous sound pool on the list
+};
+
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
 // Audio data context
@@ -383,7 +413,20 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        rAudioSoundPool *first;     // Pointer to first sound pool in the list
+        rAudioSoundPool *last;      // Pointer to last sound pool in the list
+    } Pool;
     rAudioProcessor *mixedProcessor;
+#if defined(SUPPORT_AUDIO_STATS)
+    struct {
+        ma_timer timer;             // Timer measuring the mixer callback
+        double lastCallbackStart;   // Start time of the previous callback (seconds)
+        double callbackTimeTotal;   // Duration of all the callbacks measured (seconds)
+        double lockWaitTotal;       // Mixer lock wait of all the callbacks measured (seconds)
+        AudioStats stats;           // Stats reported, protected by System.lock
+    } Stats;
+#endif
 } AudioData;
 
 //----------------------------------------------------------------------------------
@@ -405,6 +448,13 @@ static AudioData AUDIO = {          // Global AUDIO context
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static int MixSoundPool(float *framesOut, ma_uint32 frameCount, rAudioSoundPool *pool);
+#if defined(SUPPORT_AUDIO_STATS)
+static void UpdateAudioStats(double callbackStart, double lockWait, ma_uint32 frameCount, int buffersMixed, int voicesMixed);
+#endif
+static void GetAudioBufferGains(AudioBuffer *buffer, float *gains);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *gains);
+static void MixAudioSamplesBatch(float *samplesOut, const float **samplesIn, int inputCount, ma_uint32 sampleCount, const float *gains);
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -492,6 +542,10 @@ void InitAudioDevice(void)
         return;
     }
 
+#if defined(SUPPORT_AUDIO_STATS)
+    ma_timer_init(&AUDIO.Stats.timer);
+#endif
+
     TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
     TRACELOG(LOG_INFO, "    > Backend:       miniaudio / %s", ma_get_backend_name(AUDIO.System.context.backend));
     TRACELOG(LOG_INFO, "    > Format:        %s -> %s", ma_get_format_name(AUDIO.System.device.playback.format), ma_get_format_name(AUDIO.System.device.playback.internalFormat));
@@ -507,6 +561,11 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
+#if defined(SUPPORT_AUDIO_STATS)
+        AudioStats stats = GetAudioStats();
+        TRACELOG(LOG_INFO, "AUDIO: Mixer stats: %u callbacks, %.3f ms avg, %.3f ms max (period %.3f ms), %u underruns, %u xruns",
+            stats.callbackCount, stats.callbackTimeAvg, stats.callbackTimeMax, stats.periodTime, stats.underrunCount, stats.xrunCount);
+#endif
         ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
@@ -533,6 +592,50 @@ void SetMasterVolume(float volume)
     ma_device_set_master_volume(&AUDIO.System.device, volume);
 }
 
+// Get audio mixer callback stats
+// NOTE: Stats are accumulated since the device was initialized or ResetAudioStats() was called
+AudioStats GetAudioStats(void)
+{
+    AudioStats stats = { 0 };
+
+#if defined(SUPPORT_AUDIO_STATS)
+    if (AUDIO.System.isReady)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        {
+            stats = AUDIO.Stats.stats;
+
+            if (stats.callbackCount > 0)
+            {
+                stats.callbackTimeAvg = (float)(AUDIO.Stats.callbackTimeTotal*1000.0/stats.callbackCount);
+                stats.lockWaitAvg = (float)(AUDIO.Stats.lockWaitTotal*1000.0/stats.callbackCount);
+            }
+        }
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+#endif
+
+    return stats;
+}
+
+// Reset audio mixer callback stats
+void ResetAudioStats(void)
+{
+#if defined(SUPPORT_AUDIO_STATS)
+    if (AUDIO.System.isReady)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        {
+            memset(&AUDIO.Stats.stats, 0, sizeof(AudioStats));
+            AUDIO.Stats.callbackTimeTotal = 0.0;
+            AUDIO.Stats.lockWaitTotal = 0.0;
+            AUDIO.Stats.lastCallbackStart = 0.0;
+        }
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -1124,6 +1227,99 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Load a pool of voices sharing the data of a sound
+// NOTE: Voices follow the sound volume and pan, pitch and audio processors are not applied
+SoundPool LoadSoundPool(Sound sound, int voiceCount)
+{
+    SoundPool pool = { 0 };
+
+    if (!IsSoundReady(sound) || (voiceCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Failed to load sound pool, sound not ready");
+        return pool;
+    }
+
+    // Voices and their cursors are allocated at once, nothing is allocated while playing
+    rAudioSoundPool *soundPool = (rAudioSoundPool *)RL_CALLOC(1, sizeof(rAudioSoundPool) + voiceCount*(sizeof(const float *) + sizeof(unsigned int)));
+
+    if (soundPool == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Failed to allocate memory for sound pool");
+        return pool;
+    }
+
+    soundPool->buffer = sound.stream.buffer;
+    soundPool->frameCount = sound.frameCount;
+    soundPool->voiceCount = voiceCount;
+    soundPool->inputs = (const float **)(soundPool + 1);
+    soundPool->cursors = (unsigned int *)(soundPool->inputs + voiceCount);
+    for (int i = 0; i < voiceCount; i++) soundPool->cursors[i] = sound.frameCount;
+
+    // Track sound pool, the mixer lock is only taken here and on unloading
+    ma_mutex_lock(&AUDIO.System.lock);
+    {
+        if (AUDIO.Pool.first == NULL) AUDIO.Pool.first = soundPool;
+        else
+        {
+            AUDIO.Pool.last->next = soundPool;
+            soundPool->prev = AUDIO.Pool.last;
+        }
+
+        AUDIO.Pool.last = soundPool;
+    }
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    pool.sound = sound;
+    pool.voiceCount = voiceCount;
+    pool.pool = soundPool;
+
+    return pool;
+}
+
+// Checks if a sound pool is ready
+bool IsSoundPoolReady(SoundPool pool)
+{
+    return ((pool.pool != NULL) && (pool.voiceCount > 0) && IsSoundReady(pool.sound));
+}
+
+// Unload sound pool
+void UnloadSoundPool(SoundPool pool)
+{
+    rAudioSoundPool *soundPool = pool.pool;
+
+    if (soundPool != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        {
+            if (soundPool->prev == NULL) AUDIO.Pool.first = soundPool->next;
+            else soundPool->prev->next = soundPool->next;
+
+            if (soundPool->next == NULL) AUDIO.Pool.last = soundPool->prev;
+            else soundPool->next->prev = soundPool->prev;
+        }
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        RL_FREE(soundPool);
+    }
+}
+
+// Play sound on a free voice, the oldest voice is restarted when all of them are playing
+// NOTE: Only the request is counted here, voices are started by the mixer on its next period
+void PlaySoundPool(SoundPool pool)
+{
+    if (pool.pool != NULL) c89atomic_fetch_add_32(&pool.pool->playRequests, 1);
+}
+
+// Get number of voices playing at the last mix
+int GetSoundPoolVoicesPlaying(SoundPool pool)
+{
+    int count = 0;
+
+    if (pool.pool != NULL) count = (int)c89atomic_load_32(&pool.pool->voicesPlaying);
+
+    return count;
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -2417,18 +2613,31 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+#if defined(SUPPORT_AUDIO_STATS)
+    double callbackStart = ma_timer_get_time_in_seconds(&AUDIO.Stats.timer);
+    int buffersMixed = 0;
+    int voicesMixed = 0;
+#endif
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
     // Using a mutex here for thread-safety which makes things not real-time
     // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
     ma_mutex_lock(&AUDIO.System.lock);
+#if defined(SUPPORT_AUDIO_STATS)
+    double lockWait = ma_timer_get_time_in_seconds(&AUDIO.Stats.timer) - callbackStart;
+#endif
     {
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
             // Ignore stopped or paused sounds
             if (!audioBuffer->playing || audioBuffer->paused) continue;
 
+#if defined(SUPPORT_AUDIO_STATS)
+            buffersMixed++;
+#endif
+
             ma_uint32 framesRead = 0;
 
             while (1)
@@ -2499,6 +2708,15 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         }
     }
 
+    for (rAudioSoundPool *pool = AUDIO.Pool.first; pool != NULL; pool = pool->next)
+    {
+#if defined(SUPPORT_AUDIO_STATS)
+        voicesMixed += MixSoundPool((float *)pFramesOut, frameCount, pool);
+#else
+        MixSoundPool((float *)pFramesOut, frameCount, pool);
+#endif
+    }
+
     rAudioProcessor *processor = AUDIO.mixedProcessor;
     while (processor)
     {
@@ -2506,49 +2724,214 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
+#if defined(SUPPORT_AUDIO_STATS)
+    UpdateAudioStats(callbackStart, lockWait, frameCount, buffersMixed, voicesMixed);
+#endif
+
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
+#if defined(SUPPORT_AUDIO_STATS)
+// Accumulate the measurements of a mixer callback, called with the mixer lock held
+static void UpdateAudioStats(double callbackStart, double lockWait, ma_uint32 frameCount, int buffersMixed, int voicesMixed)
+{
+    AudioStats *stats = &AUDIO.Stats.stats;
+    double callbackTime = ma_timer_get_time_in_seconds(&AUDIO.Stats.timer) - callbackStart;
+    double periodTime = (double)frameCount/AUDIO.System.device.sampleRate;
+
+    // Mixing slower than real-time can't keep the device fed
+    if (callbackTime > periodTime) stats->underrunCount++;
+
+    // Device asked for data late, usually because a previous period was missed
+    if ((AUDIO.Stats.lastCallbackStart > 0.0) && ((callbackStart - AUDIO.Stats.lastCallbackStart) > 2.0*periodTime)) stats->xrunCount++;
+    AUDIO.Stats.lastCallbackStart = callbackStart;
+
+    int bin = (int)(10.0*callbackTime/periodTime);
+    if (bin > 10) bin = 10;
+    stats->durationHistogram[bin]++;
+
+    AUDIO.Stats.callbackTimeTotal += callbackTime;
+    AUDIO.Stats.lockWaitTotal += lockWait;
+
+    stats->callbackCount++;
+    stats->periodTime = (float)(periodTime*1000.0);
+    if ((float)(callbackTime*1000.0) > stats->callbackTimeMax) stats->callbackTimeMax = (float)(callbackTime*1000.0);
+    if ((float)(lockWait*1000.0) > stats->lockWaitMax) stats->lockWaitMax = (float)(lockWait*1000.0);
+
+    stats->buffersMixed = buffersMixed;
+    stats->voicesMixed = voicesMixed;
+    if (buffersMixed > stats->buffersMixedMax) stats->buffersMixedMax = buffersMixed;
+    if (voicesMixed > stats->voicesMixedMax) stats->voicesMixedMax = voicesMixed;
+}
+#endif
+
+// Mix the voices of a sound pool, starting the ones requested since the last period, returns voices mixed
+// NOTE: Sound data is already in device format and sample rate, it is mixed straight from the shared buffer
+static int MixSoundPool(float *framesOut, ma_uint32 frameCount, rAudioSoundPool *pool)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const float *data = (const float *)pool->buffer->data;
+
+    // Counters are compared by difference, so wrapping around is not a problem
+    ma_uint32 requests = c89atomic_load_32(&pool->playRequests);
+    ma_uint32 pending = requests - pool->playsStarted;
+    pool->playsStarted = requests;
+
+    // More requests than voices would just restart the same voices again
+    if (pending > (ma_uint32)pool->voiceCount) pending = pool->voiceCount;
+
+    for (ma_uint32 i = 0; i < pending; i++)
+    {
+        int voice = 0;
+
+        for (int v = 0; v < pool->voiceCount; v++)
+        {
+            if (pool->cursors[v] >= pool->frameCount) { voice = v; break; }
+            if (pool->cursors[v] > pool->cursors[voice]) voice = v;
+        }
+
+        pool->cursors[voice] = 0;
+    }
+
+    float gains[4] = { 0 };
+    GetAudioBufferGains(pool->buffer, gains);
+
+    // Voices covering the whole period are accumulated in one pass, voices ending in it are mixed on their own
+    int inputCount = 0;
+    int mixed = 0;
+    ma_uint32 playing = 0;
+
+    for (int v = 0; v < pool->voiceCount; v++)
+    {
+        ma_uint32 cursor = pool->cursors[v];
+        if (cursor >= pool->frameCount) continue;
+
+        ma_uint32 framesToMix = pool->frameCount - cursor;
+        mixed++;
+
+        if (framesToMix > frameCount)
+        {
+            pool->inputs[inputCount++] = data + cursor*channels;
+            framesToMix = frameCount;
+            playing++;
+        }
+        else MixAudioSamples(framesOut, data + cursor*channels, framesToMix*channels, gains);
+
+        pool->cursors[v] = cursor + framesToMix;
+    }
+
+    if (inputCount > 0) MixAudioSamplesBatch(framesOut, pool->inputs, inputCount, frameCount*channels, gains);
+
+    c89atomic_store_32(&pool->voicesPlaying, playing);
+
+    return mixed;
+}
+
 // Main mixing function, pretty simple in this project, just an accumulation
 // NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+{
+    float gains[4] = { 0 };
+    GetAudioBufferGains(buffer, gains);
+
+    MixAudioSamples(framesOut, framesIn, frameCount*AUDIO.System.device.playback.channels, gains);
+}
+
+// Get the gain of every sample of a 4 samples block, frames are interleaved so the pattern repeats
+// NOTE: With 2 channels pan is considered, other layouts only apply the volume to every channel
+static void GetAudioBufferGains(AudioBuffer *buffer, float *gains)
 {
     const float localVolume = buffer->volume;
-    const ma_uint32 channels = AUDIO.System.device.playback.channels;
 
-    if (channels == 2)  // We consider panning
+    if (AUDIO.System.device.playback.channels == 2)
     {
         const float left = buffer->pan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        gains[0] = localVolume*0.5f*left*(3.0f - left*left);
+        gains[1] = localVolume*0.5f*right*(3.0f - right*right);
+        gains[2] = gains[0];
+        gains[3] = gains[1];
+    }
+    else
+    {
+        for (int i = 0; i < 4; i++) gains[i] = localVolume;
+    }
+}
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+// Accumulate samples scaled by a 4 samples gains pattern: samplesOut[i] += samplesIn[i]*gains[i%4]
+// NOTE: Every path does the same multiply and add per sample, results match the scalar loop bit for bit
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float *gains)
+{
+    ma_uint32 i = 0;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+#if defined(RAUDIO_MIX_AVX)
+    const __m256 gains8 = _mm256_setr_ps(gains[0], gains[1], gains[2], gains[3], gains[0], gains[1], gains[2], gains[3]);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m256 mixed = _mm256_add_ps(_mm256_loadu_ps(samplesOut + i), _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i), gains8));
+        _mm256_storeu_ps(samplesOut + i, mixed);
+    }
+#endif
+#if defined(RAUDIO_MIX_SSE2)
+    const __m128 gains4 = _mm_loadu_ps(gains);
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        __m128 mixed = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gains4));
+        _mm_storeu_ps(samplesOut + i, mixed);
+    }
+#elif defined(RAUDIO_MIX_NEON)
+    const float32x4_t gains4 = vld1q_f32(gains);
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        float32x4_t mixed = vaddq_f32(vld1q_f32(samplesOut + i), vmulq_f32(vld1q_f32(samplesIn + i), gains4));
+        vst1q_f32(samplesOut + i, mixed);
+    }
+#endif
 
-            frameOut += 2;
-            frameIn += 2;
-        }
+    // Remainder starts on a multiple of 4, so the gains pattern stays in place
+    for (; i < sampleCount; i++) samplesOut[i] += (samplesIn[i]*gains[i%4]);
+}
+
+// Accumulate several inputs sharing the same gains, output is loaded and stored once per block
+// NOTE: Inputs are added in order, same result as calling MixAudioSamples() for every input
+static void MixAudioSamplesBatch(float *samplesOut, const float **samplesIn, int inputCount, ma_uint32 sampleCount, const float *gains)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_MIX_AVX)
+    const __m256 gains8 = _mm256_setr_ps(gains[0], gains[1], gains[2], gains[3], gains[0], gains[1], gains[2], gains[3]);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m256 mixed = _mm256_loadu_ps(samplesOut + i);
+        for (int k = 0; k < inputCount; k++) mixed = _mm256_add_ps(mixed, _mm256_mul_ps(_mm256_loadu_ps(samplesIn[k] + i), gains8));
+        _mm256_storeu_ps(samplesOut + i, mixed);
     }
-    else  // We do not consider panning
+#endif
+#if defined(RAUDIO_MIX_SSE2)
+    const __m128 gains4 = _mm_loadu_ps(gains);
+    for (; (i + 4) <= sampleCount; i += 4)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        __m128 mixed = _mm_loadu_ps(samplesOut + i);
+        for (int k = 0; k < inputCount; k++) mixed = _mm_add_ps(mixed, _mm_mul_ps(_mm_loadu_ps(samplesIn[k] + i), gains4));
+        _mm_storeu_ps(samplesOut + i, mixed);
+    }
+#elif defined(RAUDIO_MIX_NEON)
+    const float32x4_t gains4 = vld1q_f32(gains);
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        float32x4_t mixed = vld1q_f32(samplesOut + i);
+        for (int k = 0; k < inputCount; k++) mixed = vaddq_f32(mixed, vmulq_f32(vld1q_f32(samplesIn[k] + i), gains4));
+        vst1q_f32(samplesOut + i, mixed);
+    }
+#endif
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    for (; i < sampleCount; i++)
+    {
+        float mixed = samplesOut[i];
+        for (int k = 0; k < inputCount; k++) mixed += (samplesIn[k][i]*gains[i%4]);
+        samplesOut[i] = mixed;
     }
 }
 
@@ -39,7 +39,7 @@
 *       [rtextures] stb_image_write (Sean Barret) for image writing (BMP, TGA, PNG, JPG)
 *       [rtextures] stb_image_resize (Sean Barret) for image resizing algorithms
 *       [rtext] stb_truetype (Sean Barret) for ttf fonts loading
-*       [rtext] stb_rect_pack (Sean Barret) for rectangles packing
+*       [rtextures] stb_rect_pack (Sean Barret) for rectangles packing
 *       [rmodels] par_shapes (Philip Rideout) for parametric 3d shapes generation
 *       [rmodels] tinyobj_loader_c (Syoyo Fujita) for models loading (OBJ, MTL)
 *       [rmodels] cgltf (Johannes Kuhlmann) for models loading (glTF)
@@ -282,6 +282,23 @@ typedef struct RenderTexture {
 // RenderTexture2D, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// TextureAtlas, several images packed into a single texture
+typedef struct TextureAtlas {
+    Texture2D texture;      // Texture containing all the packed images
+    int recCount;           // Number of packed images
+    Rectangle *recs;        // Rectangles in texture for the images, same order they were provided
+} TextureAtlas;
+
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtextures module
+typedef struct rImageBatch rImageBatch;
+
+// ImageBatch, several image files being decoded by worker threads
+typedef struct ImageBatch {
+    int count;              // Number of image files in the batch
+    rImageBatch *state;     // Pointer to internal decoding state
+} ImageBatch;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -301,6 +318,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct rGlyphTable rGlyphTable;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -309,8 +330,20 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphTable *glyphTable; // Codepoint to glyph index lookup, NULL searches glyphs instead
+    int type;               // Font type (FontType), FONT_SDF fonts are drawn with the SDF shader
 } Font;
 
+// TextLayout, text glyph quads computed once to be drawn many times
+typedef struct TextLayout {
+    unsigned int textureId; // Font texture id
+    int fontType;           // Font type (FontType)
+    int quadCount;          // Number of glyph quads
+    Rectangle *quads;       // Glyph quads, relative to text position
+    Rectangle *texcoords;   // Glyph texture coordinates (normalized)
+    Vector2 size;           // Text size, same as MeasureTextEx()
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -446,6 +479,7 @@ typedef struct Wave {
 // NOTE: Actual structs are defined internally in raudio module
 typedef struct rAudioBuffer rAudioBuffer;
 typedef struct rAudioProcessor rAudioProcessor;
+typedef struct rAudioSoundPool rAudioSoundPool;
 
 // AudioStream, custom audio stream
 typedef struct AudioStream {
@@ -463,6 +497,30 @@ typedef struct Sound {
     unsigned int frameCount;    // Total number of frames (considering channels)
 } Sound;
 
+// SoundPool, voices playing overlapping copies of one sound
+typedef struct SoundPool {
+    Sound sound;                // Sound shared by all the voices, must outlive the pool
+    int voiceCount;             // Number of voices in the pool
+    rAudioSoundPool *pool;      // Pointer to internal voices data used by the mixer
+} SoundPool;
+
+// AudioStats, measurements of the audio mixer callback
+typedef struct AudioStats {
+    unsigned int callbackCount;         // Mixer callbacks measured
+    unsigned int underrunCount;         // Callbacks that took longer than the audio they produced
+    unsigned int xrunCount;             // Callbacks starting over two periods after the previous one
+    float periodTime;                   // Audio produced by the last callback (ms)
+    float callbackTimeAvg;              // Average callback duration (ms)
+    float callbackTimeMax;              // Longest callback duration (ms)
+    float lockWaitAvg;                  // Average wait for the mixer lock (ms)
+    float lockWaitMax;                  // Longest wait for the mixer lock (ms)
+    int buffersMixed;                   // Sounds and streams mixed by the last callback
+    int buffersMixedMax;                // Most sounds and streams mixed by one callback
+    int voicesMixed;                    // Sound pool voices mixed by the last callback
+    int voicesMixedMax;                 // Most sound pool voices mixed by one callback
+    unsigned int durationHistogram[11]; // Callbacks by duration in 10% steps of their period, last bin is over budget
+} AudioStats;
+
 // Music, audio stream, anything longer than ~10 seconds should be streamed
 typedef struct Music {
     AudioStream stream;         // Audio stream
@@ -506,6 +564,18 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// FrameStats, timings and draw work of a frame
+typedef struct FrameStats {
+    float update;           // Time from previous EndDrawing() to BeginDrawing() (ms)
+    float draw;             // Time from BeginDrawing() to buffers swap (ms)
+    float swap;             // Time swapping buffers (ms)
+    float wait;             // Time waiting for target FPS (ms)
+    float frame;            // Total frame time (ms)
+    int drawCalls;          // OpenGL draw calls issued
+    int vertices;           // Vertices submitted
+    int batchFlushes;       // Render batch flushes
+} FrameStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -858,7 +928,7 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF                        // SDF font generation, drawn with built-in SDF shader (see LoadFontSDF())
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -911,6 +981,22 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Frame pacing modes, how EndDrawing() waits for the target frame time
+typedef enum {
+    FRAME_PACING_DEFAULT = 0,       // Sleep and busy wait as configured at build time (SUPPORT_PARTIALBUSY_WAIT_LOOP)
+    FRAME_PACING_ABSOLUTE,          // Sleep to frame deadlines advancing by target time, busy wait only the slack learned from oversleep
+    FRAME_PACING_LATE_INPUT         // Absolute pacing, also delay input polling to right before the next frame deadline
+} FramePacingMode;
+
+// Frame time measures
+typedef enum {
+    FRAME_TIME_UPDATE = 0,          // Update time, between frames
+    FRAME_TIME_DRAW,                // Drawing time
+    FRAME_TIME_SWAP,                // Buffers swap time
+    FRAME_TIME_WAIT,                // Target FPS wait time
+    FRAME_TIME_TOTAL                // Whole frame time
+} FrameTimeMeasure;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advance users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -1042,9 +1128,14 @@ RLAPI Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera); // Get the
 
 // Timing-related functions
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
+RLAPI void SetFramePacing(int mode);                              // Set frame pacing mode (FramePacingMode), absolute modes require clock_nanosleep()
 RLAPI int GetFPS(void);                                           // Get current FPS
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
+RLAPI FrameStats GetFrameStats(void);                             // Get timings and draw counters of the last frame (requires SUPPORT_FRAME_STATS)
+RLAPI int GetFrameStatsHistory(FrameStats *stats, int count);     // Get stats of up to count recent frames (oldest first), returns frames copied
+RLAPI void GetFrameTimeHistogram(int measure, float binSize, int *bins, int binCount); // Get recent frames histogram of a FrameTimeMeasure in bins of binSize ms, last bin counts the rest
+RLAPI bool ExportFrameStats(const char *fileName);                // Export recent frames stats as CSV, returns true on success
 
 // Misc. functions
 RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
@@ -1242,6 +1333,11 @@ RLAPI Image LoadImageFromTexture(Texture2D texture);
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageReady(Image image);                                                                    // Check if an image is ready
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI ImageBatch LoadImageBatch(const char **fileNames, int count);                                      // Load several image files, decoded in parallel on worker threads
+RLAPI bool IsImageBatchReady(ImageBatch batch, int index);                                               // Check if an image of the batch is decoded (index -1 checks all of them)
+RLAPI int GetImageBatchProgress(ImageBatch batch);                                                       // Get number of images of the batch already decoded
+RLAPI Image WaitImageBatchImage(ImageBatch batch, int index);                                            // Wait for an image of the batch to be decoded, image is owned by the batch
+RLAPI void UnloadImageBatch(ImageBatch batch);                                                           // Unload image batch, stops pending decodes and frees its images
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
@@ -1256,6 +1352,7 @@ RLAPI Image GenImageWhiteNoise(int width, int height, float factor);
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
+RLAPI Image GenImageAtlas(const Image *images, int imageCount, int padding, Rectangle **recs);          // Generate image: atlas packing several images (RGBA), recs must be freed with MemFree()
 
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
@@ -1316,10 +1413,13 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI void LoadTexturesFromImageBatch(ImageBatch batch, Texture2D *textures);                             // Load textures from image batch, uploaded in order as images are decoded
+RLAPI TextureAtlas LoadTextureAtlas(const Image *images, int imageCount, int padding);                  // Load texture atlas from several images, uploaded as a single texture
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI bool IsTextureReady(Texture2D texture);                                                            // Check if a texture is ready
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
+RLAPI void UnloadTextureAtlas(TextureAtlas atlas);                                                       // Unload texture atlas from GPU memory (VRAM) and its rectangles
 RLAPI bool IsRenderTextureReady(RenderTexture2D target);                                                       // Check if a render texture is ready
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
@@ -1365,6 +1465,8 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCount);  // Load font from file with extended parameters, use NULL for fontChars and 0 for glyphCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontSDF(const char *fileName, int fontSize, int *fontChars, int glyphCount); // Load SDF font from TTF font file, sharp when drawn at any size
+RLAPI Font LoadFontFromMemorySDF(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount); // Load SDF font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **recs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1380,6 +1482,11 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyph quads placed as DrawTextEx() does
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout
+
 // Text font info functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
@@ -1404,6 +1511,10 @@ RLAPI int TextCopy(char *dst, const char *src);
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
 RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style)
+RLAPI int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...);            // Text formatting into a caller buffer, returns length written (truncated to fit)
+RLAPI const char *TextFormatArena(const char *text, ...);                                   // Text formatting into a per-thread arena, valid until ResetTextFormatArena()
+RLAPI void ResetTextFormatArena(void);                                                      // Reset calling thread arena, strings from TextFormatArena() expire
+RLAPI void UnloadTextFormatArena(void);                                                     // Unload calling thread arena memory
 RLAPI const char *TextSubtext(const char *text, int position, int length);                  // Get a piece of a text string
 RLAPI char *TextReplace(char *text, const char *replace, const char *by);                   // Replace text string (WARNING: memory must be freed!)
 RLAPI char *TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (WARNING: memory must be freed!)
@@ -1522,6 +1633,8 @@ RLAPI void InitAudioDevice(void);                                     // Initial
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
+RLAPI AudioStats GetAudioStats(void);                                 // Get audio mixer callback stats (requires SUPPORT_AUDIO_STATS)
+RLAPI void ResetAudioStats(void);                                     // Reset audio mixer callback stats
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1551,6 +1664,13 @@ RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels);
 RLAPI float *LoadWaveSamples(Wave wave);                              // Load samples data from wave as a 32bit float data array
 RLAPI void UnloadWaveSamples(float *samples);                         // Unload samples data loaded with LoadWaveSamples()
 
+// Sound pool management functions
+RLAPI SoundPool LoadSoundPool(Sound sound, int voiceCount);           // Load a pool of voices sharing the data of a sound
+RLAPI bool IsSoundPoolReady(SoundPool pool);                          // Checks if a sound pool is ready
+RLAPI void UnloadSoundPool(SoundPool pool);                           // Unload sound pool (sound is not unloaded)
+RLAPI void PlaySoundPool(SoundPool pool);                             // Play sound on a free voice (or the oldest one), lock-free
+RLAPI int GetSoundPoolVoicesPlaying(SoundPool pool);                  // Get number of voices playing at the last mix
+
 // Music management functions
 RLAPI Music LoadMusicStream(const char *fileName);                    // Load music stream from file
 RLAPI Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load music stream from data
@@ -140,6 +140,12 @@
 
     #define MSF_GIF_IMPL
     #include "external/msf_gif.h"   // GIF recording functionality
+
+    // GIF frames are encoded on a separate thread where POSIX threads are available
+    #if !defined(_WIN32) && !defined(PLATFORM_WEB)
+        #define GIF_RECORDING_THREAD
+        #include <pthread.h>        // Required for: pthread_create(), pthread_mutex_lock() [Used in GIF recording]
+    #endif
 #endif
 
 #if defined(SUPPORT_COMPRESSION_API)
@@ -209,6 +215,10 @@
     #define CHDIR chdir
 #endif
 
+#if defined(__linux__) || defined(__FreeBSD__)
+    #include <errno.h>              // Required for: EINTR [Used in WaitTimeAbsolute()]
+#endif
+
 #if defined(PLATFORM_DESKTOP)
     #define GLFW_INCLUDE_NONE       // Disable the standard OpenGL header inclusion on GLFW3
                                     // NOTE: Already provided by rlgl implementation (on glad.h)
@@ -316,6 +326,14 @@
     #define MAX_FILEPATH_LENGTH         4096        // Maximum length for filepaths (Linux PATH_MAX default value)
 #endif
 
+#ifndef MAX_FRAME_STATS_HISTORY
+    #define MAX_FRAME_STATS_HISTORY      300        // Maximum number of recent frames stats kept
+#endif
+
+#ifndef MAX_GIF_RECORD_QUEUE
+    #define MAX_GIF_RECORD_QUEUE           4        // Maximum number of GIF frames waiting to be encoded
+#endif
+
 #ifndef MAX_KEYBOARD_KEYS
     #define MAX_KEYBOARD_KEYS            512        // Maximum number of keyboard keys supported
 #endif
@@ -500,6 +518,10 @@ typedef struct CoreData {
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
         double target;                      // Desired time for one frame, if 0 not applied
+        int pacing;                         // Frame pacing mode (FramePacingMode)
+        double deadline;                    // Absolute end time of the last paced frame, advanced by target every frame
+        double sleepSlack;                  // Time busy waited after sleeping, learned from measured oversleep
+        double workTime;                    // Expected update + draw time, for late input polling
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
         unsigned long long base;            // Base time measure for hi-res timer
 #endif
@@ -519,9 +541,44 @@ static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
+#define GIF_RECORD_FRAMERATE    10          // Game frames per GIF frame
+#define GIF_FRAME_DELAY         10          // GIF frame duration, in centiseconds
+
+typedef struct GifFrame {
+    unsigned char *data;                    // Frame pixel data (RGBA)
+    int delay;                              // Frame duration, longer when previous frames were dropped
+} GifFrame;
+
 static int gifFrameCounter = 0;             // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
 static MsfGifState gifState = { 0 };        // MSGIF context state
+
+static struct {
+    int width;                              // Recorded frames width
+    int height;                             // Recorded frames height
+    int pitch;                              // Bytes between rows, negative for bottom-up frames
+    unsigned int pixelBuffer;               // Pixel buffer for asynchronous screen reads, 0 if not supported
+    bool readPending;                       // A screen read was started on last frame
+    int delay;                              // Delay for next queued frame
+    int droppedFrames;                      // Frames dropped because the queue was full
+
+    GifFrame frames[MAX_GIF_RECORD_QUEUE];  // Frames waiting to be encoded (ring buffer)
+    int head;                               // First frame waiting to be encoded
+    int count;                              // Number of frames waiting to be encoded
+#if defined(GIF_RECORDING_THREAD)
+    pthread_t threadId;                     // Encoder thread id
+    bool threadActive;                      // Encoder thread is running, frames are encoded right away otherwise
+    pthread_mutex_t mutex;                  // Frames queue mutex
+    pthread_cond_t frameQueued;             // Signaled when a frame is queued or recording stops
+    bool stop;                              // Encoder thread should exit once the queue is empty
+#endif
+} gifEncoder = { 0 };
+#endif
+
+#if defined(SUPPORT_FRAME_STATS)
+static FrameStats frameStats[MAX_FRAME_STATS_HISTORY] = { 0 };  // Recent frames stats (ring buffer)
+static int frameStatsHead = 0;              // Next frame stats position
+static int frameStatsCount = 0;             // Frames stats recorded
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
@@ -624,6 +681,20 @@ extern void UnloadFontDefault(void);        // [Module: text] Unloads default fo
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void InitTimer(void);                            // Initialize timer (hi-resolution if available)
+
+#if defined(SUPPORT_GIF_RECORDING)
+static void StartGifRecording(int width, int height);   // Start GIF recording, frames are read and encoded asynchronously
+static MsfGifResult StopGifRecording(void);             // Stop GIF recording, waits for queued frames to be encoded
+static void RecordGifFrame(void);                       // Record screen into GIF every GIF_RECORD_FRAMERATE frames
+static void QueueGifFrame(const unsigned char *pixels); // Queue a copy of a screen frame for encoding
+#if defined(GIF_RECORDING_THREAD)
+static void *GifEncoderThread(void *arg);               // GIF encoder thread function
+#endif
+#endif
+static void WaitTimeAbsolute(double destinationTime);   // Wait until an absolute time, busy waiting only the learned slack
+#if defined(SUPPORT_FRAME_STATS)
+static void RecordFrameStats(double swapTime, double waitTime); // Record timings and draw counters of the frame just finished
+#endif
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
@@ -958,9 +1029,8 @@ void CloseWindow(void)
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
-        MsfGifResult result = msf_gif_end(&gifState);
+        MsfGifResult result = StopGifRecording();
         msf_gif_free(result);
-        gifRecording = false;
     }
 #endif
 
@@ -2158,20 +2228,7 @@ void EndDrawing(void)
     // Draw record indicator
     if (gifRecording)
     {
-        #define GIF_RECORD_FRAMERATE    10
-        gifFrameCounter++;
-
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-            msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
-
-            RL_FREE(screenData);    // Free image data
-        }
+        RecordGifFrame();
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
         if (((gifFrameCounter/15)%2) == 1)
@@ -2214,6 +2271,8 @@ void EndDrawing(void)
 #endif
 
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    double swapStart = GetTime();
+
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
     // Frame time control system
@@ -2223,18 +2282,68 @@ void EndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
-    // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    double swapTime = CORE.Time.current - swapStart;
+    double workTime = CORE.Time.frame - swapTime;    // Update + draw, without a swap blocked on vsync
+    double waitTime = 0.0;
+
+    if ((CORE.Time.pacing != FRAME_PACING_DEFAULT) && (CORE.Time.target > 0.0))
     {
+        // Deadlines advance by the target time, wait errors and measurement gaps do not add up over frames
+        CORE.Time.deadline += CORE.Time.target;
+
+        // Resync after a missed frame (or a target change) instead of rushing the next frames to catch up
+        if (CORE.Time.deadline <= CORE.Time.current) CORE.Time.deadline = CORE.Time.current;
+        else if (CORE.Time.deadline > (CORE.Time.current + CORE.Time.target)) CORE.Time.deadline = CORE.Time.current + CORE.Time.target;
+
+        if (CORE.Time.deadline > CORE.Time.current)
+        {
+            WaitTimeAbsolute(CORE.Time.deadline);
+
+            CORE.Time.current = GetTime();
+            waitTime = CORE.Time.current - CORE.Time.previous;
+            CORE.Time.previous = CORE.Time.current;
+
+            CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+        }
+    }
+    else if (CORE.Time.frame < CORE.Time.target)
+    {
+        // Wait for some milliseconds...
         WaitTime(CORE.Time.target - CORE.Time.frame);
 
         CORE.Time.current = GetTime();
-        double waitTime = CORE.Time.current - CORE.Time.previous;
+        waitTime = CORE.Time.current - CORE.Time.previous;
         CORE.Time.previous = CORE.Time.current;
 
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
+    if ((CORE.Time.pacing == FRAME_PACING_LATE_INPUT) && (CORE.Time.target > 0.0))
+    {
+        // Expected work follows increases right away and decreases slowly, being late costs a whole frame
+        if (workTime > CORE.Time.workTime) CORE.Time.workTime = workTime;
+        else CORE.Time.workTime += (workTime - CORE.Time.workTime)*0.05;
+
+        // Poll input as late as possible so the next frame is done right at its deadline, with 1 ms margin
+        double inputTime = CORE.Time.deadline + CORE.Time.target - CORE.Time.workTime - 0.001;
+
+        if (inputTime > CORE.Time.current)
+        {
+            WaitTimeAbsolute(inputTime);
+
+            CORE.Time.current = GetTime();
+            double delayTime = CORE.Time.current - CORE.Time.previous;
+            CORE.Time.previous = CORE.Time.current;
+
+            waitTime += delayTime;
+            CORE.Time.frame += delayTime;
+        }
+    }
+
+#if defined(SUPPORT_FRAME_STATS)
+    RecordFrameStats(swapTime, waitTime);
+#endif
+
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
@@ -2860,6 +2969,20 @@ void SetTargetFPS(int fps)
     TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
+// Set frame pacing mode (FramePacingMode)
+// NOTE: Absolute deadline pacing needs clock_nanosleep(), other platforms keep the default wait
+void SetFramePacing(int mode)
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+    CORE.Time.pacing = mode;
+    CORE.Time.deadline = 0.0;       // Synced on next frame
+    CORE.Time.sleepSlack = 0.0005;
+    CORE.Time.workTime = 0.0;
+#else
+    if (mode != FRAME_PACING_DEFAULT) TRACELOG(LOG_WARNING, "TIMER: Frame pacing mode not supported on this platform");
+#endif
+}
+
 // Get current FPS
 // NOTE: We calculate an average framerate
 int GetFPS(void)
@@ -2899,6 +3022,101 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get timings and draw counters of the last frame
+FrameStats GetFrameStats(void)
+{
+    FrameStats stats = { 0 };
+
+#if defined(SUPPORT_FRAME_STATS)
+    if (frameStatsCount > 0) stats = frameStats[(frameStatsHead + MAX_FRAME_STATS_HISTORY - 1)%MAX_FRAME_STATS_HISTORY];
+#endif
+
+    return stats;
+}
+
+// Get stats of up to count recent frames, oldest first, returns frames copied
+int GetFrameStatsHistory(FrameStats *stats, int count)
+{
+    int copied = 0;
+
+#if defined(SUPPORT_FRAME_STATS)
+    if (count > frameStatsCount) count = frameStatsCount;
+
+    for (int i = 0; i < count; i++)
+    {
+        stats[i] = frameStats[(frameStatsHead + MAX_FRAME_STATS_HISTORY - count + i)%MAX_FRAME_STATS_HISTORY];
+    }
+
+    copied = count;
+#endif
+
+    return copied;
+}
+
+// Get recent frames histogram of a time measure, bins of binSize milliseconds
+// NOTE: Last bin counts every frame above the previous bins range
+void GetFrameTimeHistogram(int measure, float binSize, int *bins, int binCount)
+{
+    if ((bins == NULL) || (binCount <= 0)) return;
+
+    memset(bins, 0, binCount*sizeof(int));
+
+#if defined(SUPPORT_FRAME_STATS)
+    if (binSize <= 0.0f) return;
+
+    for (int i = 0; i < frameStatsCount; i++)
+    {
+        FrameStats *stats = &frameStats[i];
+        float time = 0.0f;
+
+        switch (measure)
+        {
+            case FRAME_TIME_UPDATE: time = stats->update; break;
+            case FRAME_TIME_DRAW: time = stats->draw; break;
+            case FRAME_TIME_SWAP: time = stats->swap; break;
+            case FRAME_TIME_WAIT: time = stats->wait; break;
+            case FRAME_TIME_TOTAL: time = stats->frame; break;
+            default: break;
+        }
+
+        int bin = (int)(time/binSize);
+        if (bin >= binCount) bin = binCount - 1;
+        if (bin < 0) bin = 0;
+
+        bins[bin]++;
+    }
+#endif
+}
+
+// Export recent frames stats as CSV, one line per frame, oldest first
+bool ExportFrameStats(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FRAME_STATS)
+    #define FRAME_STATS_CSV_LINE_SIZE   128
+
+    char *text = (char *)RL_CALLOC((frameStatsCount + 1)*FRAME_STATS_CSV_LINE_SIZE, sizeof(char));
+    int length = sprintf(text, "frame,update_ms,draw_ms,swap_ms,wait_ms,frame_ms,draw_calls,vertices,batch_flushes\n");
+
+    for (int i = 0; i < frameStatsCount; i++)
+    {
+        FrameStats *stats = &frameStats[(frameStatsHead + MAX_FRAME_STATS_HISTORY - frameStatsCount + i)%MAX_FRAME_STATS_HISTORY];
+
+        length += snprintf(text + length, FRAME_STATS_CSV_LINE_SIZE, "%i,%.3f,%.3f,%.3f,%.3f,%.3f,%i,%i,%i\n",
+            (int)CORE.Time.frameCounter - frameStatsCount + i, stats->update, stats->draw, stats->swap, stats->wait, stats->frame,
+            stats->drawCalls, stats->vertices, stats->batchFlushes);
+    }
+
+    success = SaveFileText(fileName, text);
+    RL_FREE(text);
+
+    if (success) TRACELOG(LOG_INFO, "TIMER: [%s] Frame stats exported successfully (%i frames)", fileName, frameStatsCount);
+#endif
+
+    return success;
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -4916,6 +5134,29 @@ static void SetupFramebuffer(int width, int height)
     }
 }
 
+#if defined(SUPPORT_FRAME_STATS)
+// Record timings and draw counters of the frame just finished, draw counters start again for next frame
+static void RecordFrameStats(double swapTime, double waitTime)
+{
+    FrameStats *stats = &frameStats[frameStatsHead];
+    rlDrawStats drawStats = rlGetDrawStats();
+
+    stats->update = (float)(CORE.Time.update*1000.0);
+    stats->draw = (float)((CORE.Time.draw - swapTime)*1000.0);
+    stats->swap = (float)(swapTime*1000.0);
+    stats->wait = (float)(waitTime*1000.0);
+    stats->frame = (float)(CORE.Time.frame*1000.0);
+    stats->drawCalls = drawStats.drawCalls;
+    stats->vertices = drawStats.vertices;
+    stats->batchFlushes = drawStats.batchFlushes;
+
+    rlResetDrawStats();
+
+    frameStatsHead = (frameStatsHead + 1)%MAX_FRAME_STATS_HISTORY;
+    if (frameStatsCount < MAX_FRAME_STATS_HISTORY) frameStatsCount++;
+}
+#endif
+
 // Initialize hi-resolution timer
 static void InitTimer(void)
 {
@@ -4947,6 +5188,14 @@ static void InitTimer(void)
 // Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timing on Win32!
 void WaitTime(double seconds)
 {
+#if defined(__linux__) || defined(__FreeBSD__)
+    if (CORE.Time.pacing != FRAME_PACING_DEFAULT)
+    {
+        WaitTimeAbsolute(GetTime() + seconds);
+        return;
+    }
+#endif
+
 #if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
     double destinationTime = GetTime() + seconds;
 #endif
@@ -4984,6 +5233,227 @@ void WaitTime(double seconds)
 #endif
 }
 
+// Wait until an absolute time (GetTime() clock), sleeping to it and busy waiting only the slack learned from oversleep
+// NOTE: Frame pacing passes the frame deadline kept in CORE.Time.deadline, which advances by the target
+// time every frame, so the deadlines do not drift with wait errors or measurement gaps
+static void WaitTimeAbsolute(double destinationTime)
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+    double sleepEnd = destinationTime - CORE.Time.sleepSlack;
+    double sleepSeconds = sleepEnd - GetTime();
+
+    if (sleepSeconds > 0.0)
+    {
+        // GetTime() may not count from the CLOCK_MONOTONIC origin, sleep end is placed on it from the current time
+        struct timespec deadline = { 0 };
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+        long long nanoSeconds = (long long)deadline.tv_sec*1000000000LL + deadline.tv_nsec + (long long)(sleepSeconds*1e9);
+        deadline.tv_sec = (time_t)(nanoSeconds/1000000000LL);
+        deadline.tv_nsec = (long)(nanoSeconds%1000000000LL);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) continue;
+
+        // Slack follows oversleep increases right away and decreases slowly
+        double oversleep = GetTime() - sleepEnd;
+        if (oversleep < 0.0) oversleep = 0.0;
+        if (oversleep > CORE.Time.sleepSlack) CORE.Time.sleepSlack = oversleep;
+        else CORE.Time.sleepSlack += (oversleep - CORE.Time.sleepSlack)*0.05;
+
+        // Keep some slack, and never busy wait for a big part of the frame
+        if (CORE.Time.sleepSlack < 0.0001) CORE.Time.sleepSlack = 0.0001;
+        if (CORE.Time.sleepSlack > 0.004) CORE.Time.sleepSlack = 0.004;
+    }
+
+    while (GetTime() < destinationTime) { }
+#else
+    double seconds = destinationTime - GetTime();
+    if (seconds > 0.0) WaitTime(seconds);
+#endif
+}
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Start GIF recording
+// NOTE: Screen is read through a pixel buffer one frame later and frames are quantized and
+// encoded on a separate thread, so recording does not stall the game
+static void StartGifRecording(int width, int height)
+{
+    gifEncoder.width = width;
+    gifEncoder.height = height;
+    gifEncoder.readPending = false;
+    gifEncoder.delay = GIF_FRAME_DELAY;
+    gifEncoder.droppedFrames = 0;
+    gifEncoder.head = 0;
+    gifEncoder.count = 0;
+
+    for (int i = 0; i < MAX_GIF_RECORD_QUEUE; i++) gifEncoder.frames[i].data = (unsigned char *)RL_MALLOC(width*height*4);
+
+    // Pixel buffer reads are bottom-up, msf_gif flips frames with a negative pitch
+    gifEncoder.pixelBuffer = rlLoadPixelBuffer(width*height*4);
+    gifEncoder.pitch = (gifEncoder.pixelBuffer != 0)? -width*4 : width*4;
+
+    msf_gif_begin(&gifState, width, height);
+
+#if defined(GIF_RECORDING_THREAD)
+    gifEncoder.stop = false;
+    pthread_mutex_init(&gifEncoder.mutex, NULL);
+    pthread_cond_init(&gifEncoder.frameQueued, NULL);
+
+    gifEncoder.threadActive = (pthread_create(&gifEncoder.threadId, NULL, &GifEncoderThread, NULL) == 0);
+    if (!gifEncoder.threadActive) TRACELOG(LOG_WARNING, "SYSTEM: Failed to create GIF encoder thread");
+#endif
+
+    gifFrameCounter = 0;
+    gifRecording = true;
+}
+
+// Stop GIF recording
+// NOTE: Queued frames still need to be encoded, result should be freed with msf_gif_free()
+static MsfGifResult StopGifRecording(void)
+{
+    // Last frame read is not queued, mapping the buffer would stall now
+    if (gifEncoder.readPending)
+    {
+        rlMapPixelBuffer(gifEncoder.pixelBuffer, gifEncoder.width*gifEncoder.height*4);
+        rlUnmapPixelBuffer(gifEncoder.pixelBuffer);
+        gifEncoder.readPending = false;
+    }
+
+#if defined(GIF_RECORDING_THREAD)
+    if (gifEncoder.threadActive)
+    {
+        pthread_mutex_lock(&gifEncoder.mutex);
+        gifEncoder.stop = true;
+        pthread_cond_signal(&gifEncoder.frameQueued);
+        pthread_mutex_unlock(&gifEncoder.mutex);
+
+        pthread_join(gifEncoder.threadId, NULL);
+        gifEncoder.threadActive = false;
+    }
+
+    pthread_cond_destroy(&gifEncoder.frameQueued);
+    pthread_mutex_destroy(&gifEncoder.mutex);
+#endif
+
+    for (int i = 0; i < MAX_GIF_RECORD_QUEUE; i++)
+    {
+        RL_FREE(gifEncoder.frames[i].data);
+        gifEncoder.frames[i].data = NULL;
+    }
+
+    if (gifEncoder.pixelBuffer != 0) rlUnloadPixelBuffer(gifEncoder.pixelBuffer);
+    gifEncoder.pixelBuffer = 0;
+
+    if (gifEncoder.droppedFrames > 0) TRACELOG(LOG_WARNING, "SYSTEM: GIF recording dropped %i frames, encoder could not keep up", gifEncoder.droppedFrames);
+
+    gifRecording = false;
+
+    return msf_gif_end(&gifState);
+}
+
+// Record screen into GIF every GIF_RECORD_FRAMERATE frames
+// NOTE: Call before drawing anything that should not be recorded
+static void RecordGifFrame(void)
+{
+    gifFrameCounter++;
+
+    // Screen read started on last frame should be complete by now
+    if (gifEncoder.readPending)
+    {
+        unsigned char *screenData = rlMapPixelBuffer(gifEncoder.pixelBuffer, gifEncoder.width*gifEncoder.height*4);
+        if (screenData != NULL) QueueGifFrame(screenData);
+        rlUnmapPixelBuffer(gifEncoder.pixelBuffer);
+
+        gifEncoder.readPending = false;
+    }
+
+    // NOTE: We record one gif frame every 10 game frames
+    if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
+    {
+        if (gifEncoder.pixelBuffer != 0)
+        {
+            rlReadScreenPixelsAsync(gifEncoder.pixelBuffer, gifEncoder.width, gifEncoder.height);
+            gifEncoder.readPending = true;
+        }
+        else
+        {
+            // Get image data for the current frame (from backbuffer)
+            // NOTE: This process is quite slow... :(
+            unsigned char *screenData = rlReadScreenPixels(gifEncoder.width, gifEncoder.height);
+            QueueGifFrame(screenData);
+
+            RL_FREE(screenData);    // Free image data
+        }
+    }
+}
+
+// Queue a copy of a screen frame for encoding
+// NOTE: When the queue is full the frame is dropped and the next one lasts longer instead
+static void QueueGifFrame(const unsigned char *pixels)
+{
+#if defined(GIF_RECORDING_THREAD)
+    if (gifEncoder.threadActive)
+    {
+        // Only this thread adds frames, a free slot can not be taken before it is filled
+        pthread_mutex_lock(&gifEncoder.mutex);
+        int index = (gifEncoder.count < MAX_GIF_RECORD_QUEUE)? (gifEncoder.head + gifEncoder.count)%MAX_GIF_RECORD_QUEUE : -1;
+        pthread_mutex_unlock(&gifEncoder.mutex);
+
+        if (index < 0)
+        {
+            gifEncoder.droppedFrames++;
+            gifEncoder.delay += GIF_FRAME_DELAY;
+            return;
+        }
+
+        memcpy(gifEncoder.frames[index].data, pixels, gifEncoder.width*gifEncoder.height*4);
+        gifEncoder.frames[index].delay = gifEncoder.delay;
+
+        pthread_mutex_lock(&gifEncoder.mutex);
+        gifEncoder.count++;
+        pthread_cond_signal(&gifEncoder.frameQueued);
+        pthread_mutex_unlock(&gifEncoder.mutex);
+    }
+    else
+#endif
+    {
+        // No encoder thread, encode right away
+        memcpy(gifEncoder.frames[0].data, pixels, gifEncoder.width*gifEncoder.height*4);
+        msf_gif_frame(&gifState, gifEncoder.frames[0].data, gifEncoder.delay, 16, gifEncoder.pitch);
+    }
+
+    gifEncoder.delay = GIF_FRAME_DELAY;
+}
+
+#if defined(GIF_RECORDING_THREAD)
+// GIF encoder thread function
+// NOTE: Quantizes and encodes queued frames until recording stops and the queue is empty
+static void *GifEncoderThread(void *arg)
+{
+    pthread_mutex_lock(&gifEncoder.mutex);
+
+    while (true)
+    {
+        while ((gifEncoder.count == 0) && !gifEncoder.stop) pthread_cond_wait(&gifEncoder.frameQueued, &gifEncoder.mutex);
+        if (gifEncoder.count == 0) break;
+
+        GifFrame *frame = &gifEncoder.frames[gifEncoder.head];
+        pthread_mutex_unlock(&gifEncoder.mutex);
+
+        msf_gif_frame(&gifState, frame->data, frame->delay, 16, gifEncoder.pitch);
+
+        pthread_mutex_lock(&gifEncoder.mutex);
+        gifEncoder.head = (gifEncoder.head + 1)%MAX_GIF_RECORD_QUEUE;
+        gifEncoder.count--;
+    }
+
+    pthread_mutex_unlock(&gifEncoder.mutex);
+
+    return NULL;
+}
+#endif
+#endif  // SUPPORT_GIF_RECORDING
+
 // Swap back buffer with front buffer (screen drawing)
 void SwapScreenBuffer(void)
 {
@@ -5478,9 +5948,7 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
         {
             if (gifRecording)
             {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
+                MsfGifResult result = StopGifRecording();
 
                 SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
                 msf_gif_free(result);
@@ -5495,11 +5963,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
             }
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
                 Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+                StartGifRecording((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
                 screenshotCounter++;
 
                 TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -7355,8 +7820,8 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
@@ -353,6 +353,7 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    void *sync;                 // Fence of the last draw reading the buffer (RL_BATCH_STREAM_PERSISTENT)
 } rlVertexBuffer;
 
 // Draw call type
@@ -366,6 +367,7 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, only used to order draws when draw sorting is enabled
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -380,8 +382,16 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+    int streamMode;             // Vertex data streaming mode (rlBatchStreamMode)
 } rlRenderBatch;
 
+// rlDrawStats type, draw work counted since last rlResetDrawStats()
+typedef struct rlDrawStats {
+    int drawCalls;              // OpenGL draw calls issued (render batches and vertex arrays)
+    int vertices;               // Vertices submitted (instances counted)
+    int batchFlushes;           // Render batch flushes with vertex data to draw
+} rlDrawStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -392,6 +402,13 @@ typedef enum {
     RL_OPENGL_ES_30             // OpenGL ES 3.0 (GLSL 300 es)    
 } rlGlVersion;
 
+// Render batch vertex data streaming mode
+typedef enum {
+    RL_BATCH_STREAM_SUBDATA = 0,    // Separate buffer per attribute, updated in place with glBufferSubData() (default)
+    RL_BATCH_STREAM_ORPHAN,         // Single buffer per vertex buffer, storage orphaned before every upload
+    RL_BATCH_STREAM_PERSISTENT      // Single persistently mapped buffer written in place, fenced (GL_ARB_buffer_storage), falls back to RL_BATCH_STREAM_ORPHAN
+} rlBatchStreamMode;
+
 // Trace log level
 // NOTE: Organized by priority level
 typedef enum {
@@ -659,11 +676,13 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
+RLAPI void rlSetRenderBatchStreaming(int mode, int numBuffers);             // Set streaming mode for batches loaded next, call before rlglInit() to apply it to the default batch
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // Load a render batch system
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);                        // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
@@ -672,6 +691,11 @@ RLAPI void rlDrawRenderBatchActive(void);                                   // U
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
+RLAPI void rlEnableDrawSorting(void);                   // Enable ordering batch draws by layer and texture on flush
+RLAPI void rlDisableDrawSorting(void);                  // Disable draw sorting, draws go out in submission order
+RLAPI void rlSetDrawLayer(int layer);                   // Set layer for the following draws (lower layers are drawn first when sorting)
+RLAPI rlDrawStats rlGetDrawStats(void);                 // Get draw calls, vertices and batch flushes counted since last reset
+RLAPI void rlResetDrawStats(void);                      // Reset draw counters
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -702,6 +726,11 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlLoadPixelBuffer(int size);                           // Load pixel pack buffer (PBO) for asynchronous reads, 0 if not supported
+RLAPI void rlReadScreenPixelsAsync(unsigned int id, int width, int height); // Start reading screen pixel data into pixel buffer (RGBA, bottom row first)
+RLAPI unsigned char *rlMapPixelBuffer(unsigned int id, int size);         // Map pixel buffer data for reading, waits for the read to complete
+RLAPI void rlUnmapPixelBuffer(unsigned int id);                           // Unmap pixel buffer data
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                          // Unload pixel buffer from GPU memory
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -997,6 +1026,14 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        bool drawSorting;                   // Order draws by layer and texture on batch flush
+        int drawLayer;                      // Layer assigned to new draws
+
+        int batchStreamMode;                // Streaming mode for render batches (rlBatchStreamMode)
+        int batchBufferCount;               // Default render batch buffer count (0 for RL_DEFAULT_BATCH_BUFFERS)
+
+        rlDrawStats drawStats;              // Draw work counted since last rlResetDrawStats()
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1014,6 +1051,7 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Persistently mapped buffers support (GL_ARB_buffer_storage + GL_ARB_sync)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1050,6 +1088,7 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlDrawRenderBatchSorted(rlRenderBatch *batch, int *offsets); // Draw batch draws ordered by layer and texture
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1360,6 +1399,7 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
     }
 }
 
@@ -1536,11 +1576,90 @@ void rlSetTexture(unsigned int id)
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
         }
 #endif
     }
 }
 
+// Enable draw sorting
+// NOTE: On flush, draws are ordered by layer, then texture, keeping submission order otherwise, and adjacent
+// draws sharing texture and mode are merged, so overlapping draws with different textures are only ordered by layer
+void rlEnableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.drawSorting) rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.drawSorting = true;
+#endif
+}
+
+// Disable draw sorting
+void rlDisableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawSorting) rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.drawSorting = false;
+    RLGL.State.drawLayer = 0;
+#endif
+}
+
+// Get draw calls, vertices and batch flushes counted since last reset
+// NOTE: Draws are only counted on OpenGL 3.3+ and ES2
+rlDrawStats rlGetDrawStats(void)
+{
+    rlDrawStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.State.drawStats;
+#endif
+    return stats;
+}
+
+// Reset draw counters
+void rlResetDrawStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawStats = (rlDrawStats){ 0 };
+#endif
+}
+
+// Set layer for the following draws
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawLayer != layer)
+    {
+        RLGL.State.drawLayer = layer;
+
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+        if (draw->vertexCount > 0)
+        {
+            // Start a new draw, aligned the same way rlBegin() and rlSetTexture() do
+            // NOTE: It starts as a reset draw does, keeping the old mode would make the next rlBegin()
+            // with another mode drop the texture set by rlSetTexture() in between
+            if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+            if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+            {
+                RLGL.State.vertexCounter += draw->vertexAlignment;
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+            draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            draw->mode = RL_QUADS;
+            draw->textureId = RLGL.State.defaultTextureId;
+            draw->vertexCount = 0;
+        }
+
+        draw->layer = layer;
+    }
+#endif
+}
+
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
@@ -2077,7 +2196,8 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    int bufferCount = (RLGL.State.batchBufferCount > 0)? RLGL.State.batchBufferCount : RL_DEFAULT_BATCH_BUFFERS;
+    RLGL.defaultBatch = rlLoadRenderBatch(bufferCount, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -2194,6 +2314,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && (glFenceSync != NULL);   // Persistent batch streaming
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2468,6 +2589,16 @@ unsigned int rlGetShaderIdDefault(void)
     return id;
 }
 
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Get default shader locs
 int *rlGetShaderLocsDefault(void)
 {
@@ -2480,23 +2611,56 @@ int *rlGetShaderLocsDefault(void)
 
 // Render batch management
 //------------------------------------------------------------------------------------------------
+// Set streaming mode and buffer count for render batches
+// NOTE: Streaming modes other than RL_BATCH_STREAM_SUBDATA avoid waiting on draws still reading the
+// previous upload, RL_BATCH_STREAM_PERSISTENT works best with 3 buffers
+void rlSetRenderBatchStreaming(int mode, int numBuffers)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.batchStreamMode = mode;
+    RLGL.State.batchBufferCount = numBuffers;
+#endif
+}
+
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 {
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    batch.streamMode = RLGL.State.batchStreamMode;
+    if ((batch.streamMode == RL_BATCH_STREAM_PERSISTENT) && !RLGL.ExtSupported.bufferStorage)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Persistent buffers not supported, render batch streaming with orphaned buffers");
+        batch.streamMode = RL_BATCH_STREAM_ORPHAN;
+    }
+
+    // Single buffer layout: positions, texcoords and colors blocks one after the other
+    int texcoordsOffset = bufferElements*3*4*sizeof(float);
+    int colorsOffset = texcoordsOffset + bufferElements*2*4*sizeof(float);
+    int bufferSize = colorsOffset + bufferElements*4*4*sizeof(unsigned char);
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    // NOTE: Zeroed, so a batch loaded partway can be unloaded, see the persistent mapping below
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
+        batch.vertexBuffer[i].sync = NULL;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        // NOTE: Persistent streaming writes vertex data straight into the mapped GPU buffer, set on upload
+        if (batch.streamMode != RL_BATCH_STREAM_PERSISTENT)
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2504,10 +2668,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2540,27 +2700,81 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (batch.streamMode == RL_BATCH_STREAM_SUBDATA)
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        }
+        else
+        {
+            // Quads - Single vertex buffer holding the position, texcoord and color blocks
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (batch.streamMode == RL_BATCH_STREAM_PERSISTENT)
+            {
+                // Immutable storage mapped for the whole batch lifetime, coherent so no flush is required
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                glBufferStorage(GL_ARRAY_BUFFER, bufferSize, NULL, flags);
+                unsigned char *data = (unsigned char *)glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, flags);
+
+                if (data == NULL)
+                {
+                    // Storage is immutable and the mode is per batch, so unload the buffers loaded so far
+                    // and load the whole batch again streaming with orphaned buffers
+                    TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map persistent vertex buffer, render batch streaming with orphaned buffers");
+
+                    for (int j = i + 1; j < numBuffers; j++) RL_FREE(batch.vertexBuffer[j].indices);
+                    batch.bufferCount = i + 1;
+                    rlUnloadRenderBatch(batch);
+
+                    RLGL.State.batchStreamMode = RL_BATCH_STREAM_ORPHAN;
+                    batch = rlLoadRenderBatch(numBuffers, bufferElements);
+                    RLGL.State.batchStreamMode = RL_BATCH_STREAM_PERSISTENT;
+
+                    return batch;
+                }
+
+                memset(data, 0, bufferSize);
+
+                batch.vertexBuffer[i].vertices = (float *)data;
+                batch.vertexBuffer[i].texcoords = (float *)(data + texcoordsOffset);
+                batch.vertexBuffer[i].colors = data + colorsOffset;
+            }
+            else
+#endif
+            {
+                glBufferData(GL_ARRAY_BUFFER, bufferSize, NULL, GL_STREAM_DRAW);
+            }
+            batch.vertexBuffer[i].vboId[1] = batch.vertexBuffer[i].vboId[0];
+            batch.vertexBuffer[i].vboId[2] = batch.vertexBuffer[i].vboId[0];
+
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, (void *)(size_t)texcoordsOffset);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, (void *)(size_t)colorsOffset);
+        }
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
@@ -2591,6 +2805,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = RLGL.State.drawLayer;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2626,19 +2841,31 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glBindVertexArray(0);
         }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (batch.vertexBuffer[i].sync != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].sync);
+#endif
+
         // Delete VBOs from GPU (VRAM)
+        // NOTE: Single buffer streaming modes share vboId[0] for all vertex data, a mapped buffer is unmapped on deletion
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+        if (batch.streamMode == RL_BATCH_STREAM_SUBDATA)
+        {
+            glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+        }
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        // NOTE: Persistent batches point into the mapped buffers, if mapping failed the batch was loaded as orphaned
+        if (batch.streamMode != RL_BATCH_STREAM_PERSISTENT)
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].colors);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2657,7 +2884,22 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    int texcoordsOffset = batch->vertexBuffer[batch->currentBuffer].elementCount*3*4*sizeof(float);
+    int colorsOffset = texcoordsOffset + batch->vertexBuffer[batch->currentBuffer].elementCount*2*4*sizeof(float);
+    int bufferSize = colorsOffset + batch->vertexBuffer[batch->currentBuffer].elementCount*4*4*sizeof(unsigned char);
+
+    if ((RLGL.State.vertexCounter > 0) && (batch->streamMode == RL_BATCH_STREAM_ORPHAN))
+    {
+        // Orphan the buffer storage first, the driver hands out fresh memory instead of waiting for draws still using it
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, bufferSize, NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+        glBufferSubData(GL_ARRAY_BUFFER, texcoordsOffset, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+        glBufferSubData(GL_ARRAY_BUFFER, colorsOffset, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+    }
+
+    // NOTE: RL_BATCH_STREAM_PERSISTENT vertex data is already in the mapped buffer, nothing to upload
+    if ((RLGL.State.vertexCounter > 0) && (batch->streamMode == RL_BATCH_STREAM_SUBDATA))
     {
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
@@ -2743,13 +2985,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
 
                 // Bind vertex attrib: texcoord (shader-location = 1)
+                // NOTE: Single buffer streaming modes keep texcoords and colors in vboId[0] after the positions
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, (batch->streamMode == RL_BATCH_STREAM_SUBDATA)? 0 : (void *)(size_t)texcoordsOffset);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
 
                 // Bind vertex attrib: color (shader-location = 3)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, (batch->streamMode == RL_BATCH_STREAM_SUBDATA)? 0 : (void *)(size_t)colorsOffset);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
@@ -2774,26 +3017,45 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+            RLGL.State.drawStats.vertices += RLGL.State.vertexCounter;
+            RLGL.State.drawStats.batchFlushes++;
+
+            if (RLGL.State.drawSorting)
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                int offsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+
+                for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+                {
+                    offsets[i] = vertexOffset;
+                    vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                }
 
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
+                rlDrawRenderBatchSorted(batch, offsets);
+            }
+            else
+            {
+                for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
                 {
+                    // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                    RLGL.State.drawStats.drawCalls++;
+
+                    if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                    else
+                    {
 #if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+                        // We need to define the number of indices to be processed: elementCount*6
+                        // NOTE: The final parameter tells the GPU the offset in bytes from the
+                        // start of the index buffer to the location of the first index to process
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
 #endif
-                }
+                    }
 
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                    vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                }
             }
 
             if (!RLGL.ExtSupported.vao)
@@ -2812,6 +3074,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Fence the mapped buffer just drawn, it can't be written again until the GPU is done reading it
+    if ((batch->streamMode == RL_BATCH_STREAM_PERSISTENT) && (RLGL.State.vertexCounter > 0))
+    {
+        batch->vertexBuffer[batch->currentBuffer].sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -2832,6 +3102,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
     }
 
     // Reset active texture units for next batch
@@ -2844,6 +3115,17 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Wait for the GPU to release the next mapped buffer before rlVertex*() writes into it
+    rlVertexBuffer *nextBuffer = &batch->vertexBuffer[batch->currentBuffer];
+    if (nextBuffer->sync != NULL)
+    {
+        while (glClientWaitSync((GLsync)nextBuffer->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) { }
+        glDeleteSync((GLsync)nextBuffer->sync);
+        nextBuffer->sync = NULL;
+    }
+#endif
 #endif
 }
 
@@ -3379,6 +3661,67 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel pack buffer (PBO) for asynchronous reads
+// NOTE: Only available on OpenGL 3.3+, returns 0 otherwise
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Start reading screen pixel data into pixel buffer
+// NOTE: The read is queued on the GPU and returns right away, data is flipped vertically
+// and includes alpha, same as glReadPixels() output (see rlReadScreenPixels())
+void rlReadScreenPixelsAsync(unsigned int id, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Map pixel buffer data for reading
+// NOTE: Mapping waits for the read to complete, map it a frame later to avoid stalling
+unsigned char *rlMapPixelBuffer(unsigned int id, int size)
+{
+    unsigned char *data = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    data = (unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return data;
+}
+
+// Unmap pixel buffer data
+void rlUnmapPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Unload pixel buffer from GPU memory
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3619,12 +3962,22 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawStats.drawCalls++;
+    RLGL.State.drawStats.vertices += count;
+#endif
 }
 
 // Draw vertex array elements
 void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
 {
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawStats.drawCalls++;
+    RLGL.State.drawStats.vertices += count;
+#endif
 }
 
 // Draw vertex array instanced
@@ -3632,6 +3985,9 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+
+    RLGL.State.drawStats.drawCalls++;
+    RLGL.State.drawStats.vertices += count*instances;
 #endif
 }
 
@@ -3640,6 +3996,9 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset, instances);
+
+    RLGL.State.drawStats.drawCalls++;
+    RLGL.State.drawStats.vertices += count*instances;
 #endif
 }
 
@@ -4580,6 +4939,80 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Draw batch draws ordered by layer and texture, merging consecutive draws that share texture and mode
+// NOTE: Draws sharing layer and texture keep submission order (i.e. lines over the fill they outline),
+// vertex data stays where it was recorded, merged draws are issued with glMultiDraw*() on desktop
+static void rlDrawRenderBatchSorted(rlRenderBatch *batch, int *offsets)
+{
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int count = 0;
+
+    // Insertion sort of the non empty draws, stable so ties keep submission order
+    for (int i = 0; i < batch->drawCounter; i++)
+    {
+        rlDrawCall *draw = &batch->draws[i];
+        if (draw->vertexCount == 0) continue;
+
+        int j = count++;
+        while (j > 0)
+        {
+            rlDrawCall *prev = &batch->draws[order[j - 1]];
+
+            if ((prev->layer < draw->layer) || ((prev->layer == draw->layer) && (prev->textureId <= draw->textureId))) break;
+
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    GLint firsts[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    GLsizei counts[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    const void *indices[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+
+    for (int start = 0, end = 0; start < count; start = end)
+    {
+        rlDrawCall *draw = &batch->draws[order[start]];
+        int ranges = 0;
+
+        for (end = start; end < count; end++)
+        {
+            rlDrawCall *merged = &batch->draws[order[end]];
+            if ((merged->textureId != draw->textureId) || (merged->mode != draw->mode)) break;
+
+            firsts[ranges] = offsets[order[end]];
+            counts[ranges] = merged->vertexCount;
+            if (draw->mode == RL_QUADS)
+            {
+                counts[ranges] = merged->vertexCount/4*6;
+#if defined(GRAPHICS_API_OPENGL_33)
+                indices[ranges] = (const void *)(offsets[order[end]]/4*6*sizeof(GLuint));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+                indices[ranges] = (const void *)(offsets[order[end]]/4*6*sizeof(GLushort));
+#endif
+            }
+            ranges++;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, draw->textureId);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+        RLGL.State.drawStats.drawCalls++;
+        if (draw->mode == RL_QUADS) glMultiDrawElements(GL_TRIANGLES, counts, GL_UNSIGNED_INT, indices, ranges);
+        else glMultiDrawArrays(draw->mode, firsts, counts, ranges);
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        RLGL.State.drawStats.drawCalls += ranges;
+        for (int i = 0; i < ranges; i++)
+        {
+            if (draw->mode == RL_QUADS) glDrawElements(GL_TRIANGLES, counts[i], GL_UNSIGNED_SHORT, indices[i]);
+            else glDrawArrays(draw->mode, firsts[i], counts[i]);
+        }
+#endif
+    }
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static char *rlGetCompressedFormatName(int format)
@@ -70,12 +70,33 @@
 #ifndef BEZIER_LINE_DIVISIONS
     #define BEZIER_LINE_DIVISIONS       24      // Bezier line divisions
 #endif
+#ifndef CIRCLE_TABLE_CACHE_SIZE
+    #define CIRCLE_TABLE_CACHE_SIZE      8      // Sector sin/cos tables kept around for circle and ring drawing
+#endif
+#ifndef CIRCLE_SEGMENTS_CACHE_SIZE
+    #define CIRCLE_SEGMENTS_CACHE_SIZE  64      // Radius to segment count entries memoized
+#endif
 
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle points of a sector, x is sinf() and y is cosf() of every segment angle,
+// angles are accumulated the same way the drawing loops used to do it
+typedef struct CircleTable {
+    float startAngle;           // Sector start angle (degrees)
+    float stepLength;           // Angle between segments (degrees)
+    int segments;               // Number of segments, table holds (segments + 1) points
+    int capacity;               // Allocated points
+    unsigned int lastUsed;      // Tick of last lookup, least recently used table gets replaced
+    Vector2 *points;            // Unit circle points
+} CircleTable;
+
+// Segments needed for a full circle of some radius at SMOOTH_CIRCLE_ERROR_RATE
+typedef struct CircleSegments {
+    float radius;
+    float segments;
+} CircleSegments;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -83,10 +104,16 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (usually a white pixel)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static CircleTable circleTables[CIRCLE_TABLE_CACHE_SIZE] = { 0 };           // Cached sector tables
+static unsigned int circleTableTick = 0;                                    // Lookup counter for circleTables
+static CircleSegments circleSegments[CIRCLE_SEGMENTS_CACHE_SIZE] = { 0 };   // Memoized segment counts
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static float GetCircleSegments(float radius);                       // Segments for a full circle of radius, memoized
+static const Vector2 *GetCircleTable(float startAngle, float stepLength, int segments); // Cached unit circle points of a sector
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -360,15 +387,14 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Based on the maximum angle between segments for the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, stepLength, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -383,15 +409,13 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[2*i].x*radius, center.y + points[2*i].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[2*i + 1].x*radius, center.y + points[2*i + 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-
-            angle += (stepLength*2);
+            rlVertex2f(center.x + points[2*i + 2].x*radius, center.y + points[2*i + 2].y*radius);
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -403,10 +427,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[segments - 1].x*radius, center.y + points[segments - 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[segments].x*radius, center.y + points[segments].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -421,10 +445,8 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
         }
     rlEnd();
 #endif
@@ -448,15 +470,14 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Based on the maximum angle between segments for the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, stepLength, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -464,24 +485,22 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[0].x*radius, center.y + points[0].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[segments].x*radius, center.y + points[segments].y*radius);
         }
     rlEnd();
 }
@@ -580,9 +599,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Based on the maximum angle between segments for the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -595,7 +613,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, stepLength, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -606,18 +624,16 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + points[i + 1].x*outerRadius, center.y + points[i + 1].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
         }
     rlEnd();
 
@@ -628,15 +644,13 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
+            rlVertex2f(center.x + points[i + 1].x*outerRadius, center.y + points[i + 1].y*outerRadius);
         }
     rlEnd();
 #endif
@@ -670,9 +684,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Based on the maximum angle between segments for the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -684,35 +697,33 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, stepLength, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[0].x*outerRadius, center.y + points[0].y*outerRadius);
+            rlVertex2f(center.x + points[0].x*innerRadius, center.y + points[0].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
+            rlVertex2f(center.x + points[i + 1].x*outerRadius, center.y + points[i + 1].y*outerRadius);
 
-            angle += stepLength;
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[segments].x*outerRadius, center.y + points[segments].y*outerRadius);
+            rlVertex2f(center.x + points[segments].x*innerRadius, center.y + points[segments].y*innerRadius);
         }
     rlEnd();
 }
@@ -937,9 +948,8 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
+        // Based on the maximum angle between segments for the error rate (usually 0.5f)
+        segments = (int)(GetCircleSegments(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -1157,9 +1167,8 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
+        // Based on the maximum angle between segments for the error rate (usually 0.5f)
+        segments = (int)(GetCircleSegments(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -1784,6 +1793,69 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+// Get the number of segments a full circle of some radius needs to stay within SMOOTH_CIRCLE_ERROR_RATE
+// NOTE: Results are memoized by radius, so steady state drawing does no acosf()/powf()
+static float GetCircleSegments(float radius)
+{
+    union { float f; unsigned int u; } key = { radius };
+    CircleSegments *entry = &circleSegments[(key.u ^ (key.u >> 15))%CIRCLE_SEGMENTS_CACHE_SIZE];
+
+    if (entry->radius != radius)
+    {
+        // Calculate the maximum angle between segments based on the error rate
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+
+        entry->radius = radius;
+        entry->segments = ceilf(2*PI/th);
+    }
+
+    return entry->segments;
+}
+
+// Get unit circle points for a sector, (segments + 1) points starting at startAngle
+// NOTE: Tables are cached by angles and segment count, the least recently used one is replaced on a miss
+static const Vector2 *GetCircleTable(float startAngle, float stepLength, int segments)
+{
+    CircleTable *table = &circleTables[0];
+
+    circleTableTick++;
+
+    for (int i = 0; i < CIRCLE_TABLE_CACHE_SIZE; i++)
+    {
+        CircleTable *candidate = &circleTables[i];
+
+        if ((candidate->points != NULL) && (candidate->segments == segments) &&
+            (candidate->startAngle == startAngle) && (candidate->stepLength == stepLength))
+        {
+            candidate->lastUsed = circleTableTick;
+            return candidate->points;
+        }
+
+        if (candidate->lastUsed < table->lastUsed) table = candidate;
+    }
+
+    if (table->capacity < segments + 1)
+    {
+        table->points = (Vector2 *)RL_REALLOC(table->points, (segments + 1)*sizeof(Vector2));
+        table->capacity = segments + 1;
+    }
+
+    float angle = startAngle;
+
+    for (int i = 0; i <= segments; i++)
+    {
+        table->points[i] = (Vector2){ sinf(DEG2RAD*angle), cosf(DEG2RAD*angle) };
+        angle += stepLength;
+    }
+
+    table->startAngle = startAngle;
+    table->stepLength = stepLength;
+    table->segments = segments;
+    table->lastUsed = circleTableTick;
+
+    return table->points;
+}
+
 // Cubic easing in-out
 // NOTE: Used by DrawLineBezier() only
 static float EaseCubicInOut(float t, float b, float c, float d)
@@ -15,6 +15,11 @@
 *           Load default raylib font on initialization to be used by DrawText() and MeasureText().
 *           If no default font loaded, DrawTextEx() and MeasureTextEx() are required.
 *
+*       #define SUPPORT_TEXT_LAYOUT_CACHE
+*           Keep the layouts of recently drawn strings (least recently used are evicted),
+*           DrawTextEx() reuses them while the text does not change.
+*           NOTE: The cache is not locked, only DrawTextEx() uses it, so it stays on the GL thread
+*
 *       #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 *           TextSplit() function static buffer max size
 *
@@ -66,8 +71,7 @@
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
-    #define STB_RECT_PACK_IMPLEMENTATION
-    #include "external/stb_rect_pack.h"     // Required for: ttf font rectangles packaging
+    #include "external/stb_rect_pack.h"     // Required for: ttf font rectangles packaging (implementation in rtextures)
 
     #define STBTT_STATIC
     #define STB_TRUETYPE_IMPLEMENTATION
@@ -88,10 +92,66 @@
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
 
+#ifndef TEXT_FORMAT_ARENA_SIZE
+    #define TEXT_FORMAT_ARENA_SIZE             16384        // Size of per-thread memory blocks used by TextFormatArena()
+#endif
+#ifndef MAX_TEXT_LAYOUT_CACHE
+    #define MAX_TEXT_LAYOUT_CACHE                 32        // Maximum number of text layouts cached
+#endif
+#ifndef MAX_TEXT_LAYOUT_CACHE_LENGTH
+    #define MAX_TEXT_LAYOUT_CACHE_LENGTH         128        // Maximum text length cached, in bytes (including '\0')
+#endif
+
+#define GLYPH_TABLE_DIRECT_SIZE                  128        // Codepoints below this are direct mapped in glyph tables
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Glyph table slot, hashed codepoint to glyph index
+typedef struct GlyphTableSlot {
+    int codepoint;                  // Glyph codepoint
+    int index;                      // Glyph index in font, -1 for an empty slot
+} GlyphTableSlot;
+
+// Glyph table, codepoint to glyph index lookup built when the font is loaded
+// NOTE: ASCII codepoints are direct mapped, the rest use open addressing with linear probing
+struct rGlyphTable {
+    int fallbackIndex;                              // Glyph index for codepoints not in the font ('?')
+    int direct[GLYPH_TABLE_DIRECT_SIZE];            // Glyph index for codepoints 0..127, -1 if not in the font
+    int shift;                                      // Hash shift, 32 - log2(slots count)
+    unsigned int mask;                              // Slots count - 1 (power of two)
+    GlyphTableSlot slots[];                         // Hashed slots for codepoints 128 and above
+};
+
+// Text format arena memory block
+// NOTE: Blocks are chained and kept on reset, reused in order for next strings
+typedef struct TextArenaBlock {
+    struct TextArenaBlock *next;                    // Next block in arena
+    int size;                                       // Block data size
+    int used;                                       // Block data used
+    char data[];                                    // Block data
+} TextArenaBlock;
+
+// Text format arena, one per thread
+typedef struct TextArena {
+    TextArenaBlock *first;                          // First block, NULL until first use
+    TextArenaBlock *current;                        // Block strings are being added to
+} TextArena;
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+// Text layout cache entry
+typedef struct TextLayoutCacheEntry {
+    bool active;                                    // Entry holds a layout
+    unsigned int hash;                              // Text hash
+    unsigned int textureId;                         // Font texture id
+    const GlyphInfo *glyphs;                        // Font glyphs, tells apart fonts sharing a texture
+    float fontSize;                                 // Font size used for the layout
+    float spacing;                                  // Spacing used for the layout
+    unsigned int lastUse;                           // Cache use counter on last use
+    char text[MAX_TEXT_LAYOUT_CACHE_LENGTH];        // Text copy
+    TextLayout layout;                              // Cached layout
+} TextLayoutCacheEntry;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -102,6 +162,67 @@
 static Font defaultFont = { 0 };
 #endif
 
+// SDF font fragment shader
+// NOTE: Distance is stored on alpha, edge smoothing width follows screen derivatives so it stays
+// around one pixel at any drawing size, default vertex shader is used
+#if defined(GRAPHICS_API_OPENGL_21)
+static const char *fontShaderCodeSDF =
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture2D(texture0, fragTexCoord).a - 0.5;                \n"
+    "    float width = length(vec2(dFdx(distance), dFdy(distance)));                \n"
+    "    float alpha = smoothstep(-width, width, distance);                         \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;          \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+static const char *fontShaderCodeSDF =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture(texture0, fragTexCoord).a - 0.5;                  \n"
+    "    float width = length(vec2(dFdx(distance), dFdy(distance)));                \n"
+    "    float alpha = smoothstep(-width, width, distance);                         \n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;            \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+static const char *fontShaderCodeSDF =
+    "#version 100                       \n"
+    "#extension GL_OES_standard_derivatives : enable    \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture2D(texture0, fragTexCoord).a - 0.5;                \n"
+    "    float width = length(vec2(dFdx(distance), dFdy(distance)));                \n"
+    "    float alpha = smoothstep(-width, width, distance);                         \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;          \n"
+    "}                                  \n";
+#else
+static const char *fontShaderCodeSDF = NULL;    // No shaders support, SDF fonts are drawn as regular fonts
+#endif
+
+static Shader fontShaderSDF = { 0 };                                            // SDF font shader, loaded on first use
+
+static RL_THREAD_LOCAL TextArena textArena = { 0 };                           // Text format arena for calling thread
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+static TextLayoutCacheEntry textLayoutCache[MAX_TEXT_LAYOUT_CACHE] = { 0 };    // Recently used text layouts
+static unsigned int textLayoutCacheCounter = 0;                                 // Text layout cache use counter
+#endif
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -119,6 +240,16 @@ extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
 #endif
 
+static rGlyphTable *LoadGlyphTable(const GlyphInfo *glyphs, int glyphCount);   // Load codepoint to glyph index lookup table
+static Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type);  // Load font of a type (FontType) from memory buffer
+static bool BeginFontShader(int fontType);              // Begin shader required by font type, returns true if it has to be ended
+static void EndFontShader(bool active);                 // End shader started by BeginFontShader()
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+static TextLayout *GetCachedTextLayout(Font font, const char *text, float fontSize, float spacing);  // Get text layout from cache, loaded if missing
+static void ClearTextLayoutCache(unsigned int textureId);                       // Unload cached text layouts for a font texture (0 for all)
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -269,6 +400,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphTable = LoadGlyphTable(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -276,10 +408,19 @@ extern void LoadFontDefault(void)
 // Unload raylib default font
 extern void UnloadFontDefault(void)
 {
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    ClearTextLayoutCache(0);    // Called on CloseWindow(), no other font is valid from now on
+#endif
+
+    // SDF shader goes with the graphics context
+    if (fontShaderSDF.id != 0) UnloadShader(fontShaderSDF);
+    fontShaderSDF = (Shader){ 0 };
+
     for (int i = 0; i < defaultFont.glyphCount; i++) UnloadImage(defaultFont.glyphs[i].image);
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphTable);
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -485,12 +626,46 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphTable = LoadGlyphTable(font.glyphs, font.glyphCount);
 
     return font;
 }
 
 // Load font from memory buffer, fileType refers to extension: i.e. ".ttf"
 Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount)
+{
+    return LoadFontFromMemoryType(fileType, fileData, dataSize, fontSize, fontChars, glyphCount, FONT_DEFAULT);
+}
+
+// Load SDF font from TTF font file
+// NOTE: Glyphs store distances to their outline, the SDF shader keeps edges sharp at any drawing size,
+// so one small atlas is enough for all sizes
+Font LoadFontSDF(const char *fileName, int fontSize, int *fontChars, int glyphCount)
+{
+    Font font = { 0 };
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        font = LoadFontFromMemorySDF(GetFileExtension(fileName), fileData, fileSize, fontSize, fontChars, glyphCount);
+
+        UnloadFileData(fileData);
+    }
+    else font = GetFontDefault();
+
+    return font;
+}
+
+// Load SDF font from memory buffer, fileType refers to extension: i.e. ".ttf"
+Font LoadFontFromMemorySDF(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount)
+{
+    return LoadFontFromMemoryType(fileType, fileData, dataSize, fontSize, fontChars, glyphCount, FONT_SDF);
+}
+
+// Load font of a type (FontType) from memory buffer
+static Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type)
 {
     Font font = { 0 };
 
@@ -504,15 +679,20 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
         font.baseSize = fontSize;
         font.glyphCount = (glyphCount > 0)? glyphCount : 95;
         font.glyphPadding = 0;
-        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, fontChars, font.glyphCount, FONT_DEFAULT);
+        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, fontChars, font.glyphCount, type);
 
         if (font.glyphs != NULL)
         {
-            font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+            // NOTE: SDF glyphs already include padding (FONT_SDF_CHAR_PADDING)
+            font.type = type;
+            font.glyphPadding = (type == FONT_SDF)? 0 : FONT_TTF_DEFAULT_CHARS_PADDING;
 
             Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
             font.texture = LoadTextureFromImage(atlas);
 
+            // SDF shader requires interpolated distances
+            if (type == FONT_SDF) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+
             // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
             for (int i = 0; i < font.glyphCount; i++)
             {
@@ -522,6 +702,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
             UnloadImage(atlas);
 
+            font.glyphTable = LoadGlyphTable(font.glyphs, font.glyphCount);
+
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
         }
         else font = GetFontDefault();
@@ -856,8 +1038,12 @@ void UnloadFont(Font font)
     if (font.texture.id != GetFontDefault().texture.id)
     {
         UnloadFontData(font.glyphs, font.glyphCount);
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+        ClearTextLayoutCache(font.texture.id);
+#endif
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.glyphTable);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1055,6 +1241,16 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 {
     if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    TextLayout *layout = GetCachedTextLayout(font, text, fontSize, spacing);
+
+    if (layout != NULL)
+    {
+        DrawTextLayout(*layout, position, tint);
+        return;
+    }
+#endif
+
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
     int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
@@ -1062,6 +1258,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool fontShader = BeginFontShader(font.type);
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
@@ -1089,6 +1287,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    EndFontShader(fontShader);
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1126,8 +1326,218 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
     // Draw the character texture on the screen
+    bool fontShader = BeginFontShader(font.type);
     DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    EndFontShader(fontShader);
+}
+
+// Load text layout, glyph quads placed as DrawTextEx() does
+// NOTE: Only the font texture id is kept, layout must not be drawn after unloading the font
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if ((font.texture.id == 0) || (text == NULL)) return layout;
+
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    layout.textureId = font.texture.id;
+    layout.fontType = font.type;
+    layout.size = MeasureTextEx(font, text, fontSize, spacing);
+    if (size == 0) return layout;
+
+    // Enough quads for one glyph per byte, some are unused on multibyte codepoints and spaces
+    layout.quads = (Rectangle *)RL_MALLOC(size*sizeof(Rectangle));
+    layout.texcoords = (Rectangle *)RL_MALLOC(size*sizeof(Rectangle));
+
+    int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Fixed line spacing of 1.5 line-height
+            textOffsetY += (int)((font.baseSize + font.baseSize/2.0f)*scaleFactor);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Same quad as DrawTextCodepoint(), glyph padding included
+                Rectangle rec = font.recs[index];
+
+                layout.quads[layout.quadCount] = (Rectangle){ textOffsetX + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor,
+                    textOffsetY + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor,
+                    (rec.width + 2.0f*padding)*scaleFactor, (rec.height + 2.0f*padding)*scaleFactor };
+
+                layout.texcoords[layout.quadCount] = (Rectangle){ (rec.x - padding)/font.texture.width, (rec.y - padding)/font.texture.height,
+                    (rec.width + 2.0f*padding)/font.texture.width, (rec.height + 2.0f*padding)/font.texture.height };
+
+                layout.quadCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    return layout;
+}
+
+// Unload text layout
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.quads);
+    RL_FREE(layout.texcoords);
+}
+
+// Draw text layout
+// NOTE: All glyph quads go to the render batch at once
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if ((layout.textureId == 0) || (layout.quadCount == 0)) return;
+
+    bool fontShader = BeginFontShader(layout.fontType);
+
+    rlSetTexture(layout.textureId);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);              // Normal vector pointing towards viewer
+
+        for (int i = 0; i < layout.quadCount; i++)
+        {
+            Rectangle quad = layout.quads[i];
+            Rectangle texcoord = layout.texcoords[i];
+            float x = position.x + quad.x;
+            float y = position.y + quad.y;
+
+            // Top-left, bottom-left, bottom-right and top-right corners, same order as DrawTexturePro()
+            rlTexCoord2f(texcoord.x, texcoord.y);
+            rlVertex2f(x, y);
+
+            rlTexCoord2f(texcoord.x, texcoord.y + texcoord.height);
+            rlVertex2f(x, y + quad.height);
+
+            rlTexCoord2f(texcoord.x + texcoord.width, texcoord.y + texcoord.height);
+            rlVertex2f(x + quad.width, y + quad.height);
+
+            rlTexCoord2f(texcoord.x + texcoord.width, texcoord.y);
+            rlVertex2f(x + quad.width, y);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+
+    EndFontShader(fontShader);
+}
+
+// Begin shader required by font type, returns true if it has to be ended
+// NOTE: SDF fonts use the built-in SDF shader, unless a custom shader is already active
+// (i.e. an SDF shader with outline or glow effects)
+static bool BeginFontShader(int fontType)
+{
+    if ((fontType != FONT_SDF) || (fontShaderCodeSDF == NULL)) return false;
+    if (rlGetShaderIdCurrent() != rlGetShaderIdDefault()) return false;
+
+    if (fontShaderSDF.id == 0) fontShaderSDF = LoadShaderFromMemory(NULL, fontShaderCodeSDF);
+
+    // Shader failed to compile, default shader was returned
+    if (fontShaderSDF.id == rlGetShaderIdDefault()) return false;
+
+    BeginShaderMode(fontShaderSDF);
+
+    return true;
+}
+
+// End shader started by BeginFontShader()
+static void EndFontShader(bool active)
+{
+    if (active) EndShaderMode();
+}
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+// Get text layout from cache, loaded if missing
+// NOTE: Returns NULL for texts too long to be cached, returned layout is valid until next call
+// WARNING: Cache is not locked, it must only be used from the GL thread (DrawTextEx())
+static TextLayout *GetCachedTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    if (text == NULL) return NULL;
+
+    // FNV-1a hash, text length checked on the way
+    unsigned int hash = 2166136261u;
+    int length = 0;
+
+    while (text[length] != '\0')
+    {
+        if (length == (MAX_TEXT_LAYOUT_CACHE_LENGTH - 1)) return NULL;
+
+        hash = (hash ^ (unsigned char)text[length])*16777619u;
+        length++;
+    }
+
+    textLayoutCacheCounter++;
+
+    // Look for the text, keeping the least recently used entry to be replaced on miss
+    TextLayoutCacheEntry *oldest = &textLayoutCache[0];
+
+    for (int i = 0; i < MAX_TEXT_LAYOUT_CACHE; i++)
+    {
+        TextLayoutCacheEntry *entry = &textLayoutCache[i];
+
+        if (entry->active && (entry->hash == hash) && (entry->textureId == font.texture.id) && (entry->glyphs == font.glyphs) &&
+            (entry->fontSize == fontSize) && (entry->spacing == spacing) && (memcmp(entry->text, text, length + 1) == 0))
+        {
+            entry->lastUse = textLayoutCacheCounter;
+            return &entry->layout;
+        }
+
+        if (!entry->active || (oldest->active && (entry->lastUse < oldest->lastUse))) oldest = entry;
+    }
+
+    if (oldest->active) UnloadTextLayout(oldest->layout);
+
+    oldest->active = true;
+    oldest->hash = hash;
+    oldest->textureId = font.texture.id;
+    oldest->glyphs = font.glyphs;
+    oldest->fontSize = fontSize;
+    oldest->spacing = spacing;
+    oldest->lastUse = textLayoutCacheCounter;
+    memcpy(oldest->text, text, length + 1);
+    oldest->layout = LoadTextLayout(font, text, fontSize, spacing);
+
+    return &oldest->layout;
+}
+
+// Unload cached text layouts for a font texture (0 for all)
+static void ClearTextLayoutCache(unsigned int textureId)
+{
+    for (int i = 0; i < MAX_TEXT_LAYOUT_CACHE; i++)
+    {
+        TextLayoutCacheEntry *entry = &textLayoutCache[i];
+
+        if (entry->active && ((textureId == 0) || (entry->textureId == textureId)))
+        {
+            UnloadTextLayout(entry->layout);
+            entry->active = false;
+        }
+    }
 }
+#endif
 
 // Draw multiple character (codepoints)
 void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 position, float fontSize, float spacing, Color tint)
@@ -1137,6 +1547,8 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool fontShader = BeginFontShader(font.type);
+
     for (int i = 0; i < count; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1159,6 +1571,8 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    EndFontShader(fontShader);
 }
 
 // Measure string width for default font
@@ -1180,6 +1594,7 @@ int MeasureText(const char *text, int fontSize)
 }
 
 // Measure string size for Font
+// NOTE: No global state is used, it can be called from any thread
 Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
 {
     Vector2 textSize = { 0 };
@@ -1239,6 +1654,29 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+    // Fonts loaded by raylib come with a lookup table, others are searched
+    if (font.glyphTable != NULL)
+    {
+        const rGlyphTable *table = font.glyphTable;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_TABLE_DIRECT_SIZE)) index = table->direct[codepoint];
+        else
+        {
+            index = -1;
+
+            for (unsigned int slot = ((unsigned int)codepoint*2654435769u) >> table->shift; table->slots[slot].index >= 0; slot = (slot + 1) & table->mask)
+            {
+                if (table->slots[slot].codepoint == codepoint)
+                {
+                    index = table->slots[slot].index;
+                    break;
+                }
+            }
+        }
+
+        return (index >= 0)? index : table->fallbackIndex;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -1263,6 +1701,51 @@ int GetGlyphIndex(Font font, int codepoint)
     return index;
 }
 
+// Load codepoint to glyph index lookup table
+// NOTE: Results match the glyphs search in GetGlyphIndex(): first glyph for a codepoint, last '?' as fallback
+static rGlyphTable *LoadGlyphTable(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    // Hashed slots at least twice the glyphs count keep probe sequences short
+    int shift = 32 - 4;
+    while ((1 << (32 - shift)) < 2*glyphCount) shift--;
+    unsigned int slotCount = 1u << (32 - shift);
+
+    rGlyphTable *table = (rGlyphTable *)RL_MALLOC(sizeof(rGlyphTable) + slotCount*sizeof(GlyphTableSlot));
+
+    table->fallbackIndex = 0;
+    table->shift = shift;
+    table->mask = slotCount - 1;
+    for (int i = 0; i < GLYPH_TABLE_DIRECT_SIZE; i++) table->direct[i] = -1;
+    for (unsigned int i = 0; i < slotCount; i++) table->slots[i].index = -1;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+
+        if (codepoint == 63) table->fallbackIndex = i;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_TABLE_DIRECT_SIZE))
+        {
+            if (table->direct[codepoint] < 0) table->direct[codepoint] = i;
+        }
+        else
+        {
+            unsigned int slot = ((unsigned int)codepoint*2654435769u) >> shift;
+            while ((table->slots[slot].index >= 0) && (table->slots[slot].codepoint != codepoint)) slot = (slot + 1) & table->mask;
+
+            if (table->slots[slot].index < 0)
+            {
+                table->slots[slot].codepoint = codepoint;
+                table->slots[slot].index = i;
+            }
+        }
+    }
+
+    return table;
+}
+
 // Get glyph font info data for a codepoint (unicode character)
 // NOTE: If codepoint is not found in the font it fallbacks to '?'
 GlyphInfo GetGlyphInfo(Font font, int codepoint)
@@ -1303,6 +1786,7 @@ unsigned int TextLength(const char *text)
 
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// NOTE: Buffers are per thread, use TextFormatArena() or TextFormatBuffer() for longer lived strings
 const char *TextFormat(const char *text, ...)
 {
 #ifndef MAX_TEXTFORMAT_BUFFERS
@@ -1310,8 +1794,8 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
@@ -1327,6 +1811,104 @@ const char *TextFormat(const char *text, ...)
     return currentBuffer;
 }
 
+// Formatting of text with variables into a caller buffer
+// NOTE: Text is truncated to bufferSize - 1 bytes, returns length written (not including '\0')
+int TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...)
+{
+    if ((buffer == NULL) || (bufferSize <= 0)) return 0;
+
+    va_list args;
+    va_start(args, text);
+    int length = vsnprintf(buffer, bufferSize, text, args);
+    va_end(args);
+
+    if (length < 0) { buffer[0] = '\0'; length = 0; }
+    else if (length >= bufferSize) length = bufferSize - 1;
+
+    return length;
+}
+
+// Formatting of text with variables into calling thread arena
+// NOTE: Strings stay valid until ResetTextFormatArena() is called on the same thread,
+// memory is only allocated while the arena grows, it is reused after every reset
+const char *TextFormatArena(const char *text, ...)
+{
+    va_list args;
+    va_start(args, text);
+
+    TextArenaBlock *block = textArena.current;
+    int available = (block != NULL)? (block->size - block->used) : 0;
+
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int length = vsnprintf((block != NULL)? block->data + block->used : NULL, available, text, argsCopy);
+    va_end(argsCopy);
+
+    if (length < 0) length = 0;
+
+    // Not enough space left, move to next block (reused from previous frames, or a new one)
+    if (length >= available)
+    {
+        TextArenaBlock *previous = block;
+        block = (previous != NULL)? previous->next : textArena.first;
+
+        if ((block == NULL) || (block->size < (length + 1)))
+        {
+            int size = (length + 1 > TEXT_FORMAT_ARENA_SIZE)? length + 1 : TEXT_FORMAT_ARENA_SIZE;
+            TextArenaBlock *newBlock = (TextArenaBlock *)RL_MALLOC(sizeof(TextArenaBlock) + size);
+
+            if (newBlock == NULL)
+            {
+                va_end(args);
+                return NULL;
+            }
+
+            newBlock->size = size;
+            newBlock->used = 0;
+            newBlock->next = block;     // Blocks too small for this string are kept for next ones
+
+            if (previous != NULL) previous->next = newBlock;
+            else textArena.first = newBlock;
+            block = newBlock;
+        }
+
+        block->used = 0;
+        textArena.current = block;
+
+        vsnprintf(block->data, length + 1, text, args);
+    }
+
+    va_end(args);
+
+    char *result = block->data + block->used;
+    block->used += length + 1;
+
+    return result;
+}
+
+// Reset calling thread arena, strings from TextFormatArena() expire
+void ResetTextFormatArena(void)
+{
+    if (textArena.first != NULL) textArena.first->used = 0;
+    textArena.current = textArena.first;
+}
+
+// Unload calling thread arena memory
+void UnloadTextFormatArena(void)
+{
+    TextArenaBlock *block = textArena.first;
+
+    while (block != NULL)
+    {
+        TextArenaBlock *next = block->next;
+        RL_FREE(block);
+        block = next;
+    }
+
+    textArena.first = NULL;
+    textArena.current = NULL;
+}
+
 // Get integer value from text
 // NOTE: This function replaces atoi() [stdlib.h]
 int TextToInteger(const char *text)
@@ -2094,7 +2676,11 @@ static Font LoadBMFont(const char *fileName)
         font = GetFontDefault();
         TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
     }
-    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    else
+    {
+        font.glyphTable = LoadGlyphTable(font.glyphs, font.glyphCount);
+        TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    }
 
     return font;
 }
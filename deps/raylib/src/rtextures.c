@@ -194,6 +194,16 @@
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8() [ImageResize()]
 
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"     // Required for: stbrp_pack_rects() [GenImageAtlas(), GenImageFontAtlas()]
+
+// Image batches are decoded on worker threads where POSIX threads are available
+#if !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #define IMAGE_BATCH_THREADS
+    #include <pthread.h>                // Required for: pthread_create(), pthread_mutex_lock() [Used in LoadImageBatch()]
+    #include <unistd.h>                 // Required for: sysconf() [Used in LoadImageBatch()]
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -205,10 +215,32 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef MAX_IMAGE_ATLAS_SIZE
+    #define MAX_IMAGE_ATLAS_SIZE  16384    // Maximum width/height GenImageAtlas() grows the atlas to
+#endif
+
+#ifndef MAX_IMAGE_BATCH_THREADS
+    #define MAX_IMAGE_BATCH_THREADS   8    // Maximum number of worker threads decoding an image batch
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image batch internal state, images are decoded in order by a pool of worker threads
+struct rImageBatch {
+    int count;                          // Number of images in the batch
+    char **fileNames;                   // Copies of the image file names
+    Image *images;                      // Decoded images, valid once its done flag is set
+    bool *done;                         // Decoded flag for every image
+    int next;                           // Next image to be picked by a worker
+    int doneCount;                      // Number of images already decoded
+#if defined(IMAGE_BATCH_THREADS)
+    pthread_t threads[MAX_IMAGE_BATCH_THREADS]; // Worker threads
+    int threadCount;                    // Number of worker threads running
+    pthread_mutex_t mutex;              // Batch state mutex
+    pthread_cond_t imageDone;           // Signaled every time an image is decoded
+#endif
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -224,6 +256,9 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+#if defined(IMAGE_BATCH_THREADS)
+static void *ImageBatchThread(void *arg);                   // Image batch worker thread, decodes images until none is left
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -518,6 +553,158 @@ void UnloadImage(Image image)
     RL_FREE(image.data);
 }
 
+// Load several image files, decoded in parallel on worker threads
+// NOTE: Images are picked in order, so waiting on them in order overlaps the upload of
+// one image with the decoding of the following ones
+ImageBatch LoadImageBatch(const char **fileNames, int count)
+{
+    ImageBatch batch = { 0 };
+
+    if ((fileNames == NULL) || (count <= 0)) return batch;
+
+    rImageBatch *state = (rImageBatch *)RL_CALLOC(1, sizeof(rImageBatch));
+    state->fileNames = (char **)RL_CALLOC(count, sizeof(char *));
+    state->images = (Image *)RL_CALLOC(count, sizeof(Image));
+    state->done = (bool *)RL_CALLOC(count, sizeof(bool));
+    state->count = count;
+
+    for (int i = 0; i < count; i++)
+    {
+        int length = (int)strlen(fileNames[i]);
+        state->fileNames[i] = (char *)RL_MALLOC(length + 1);
+        memcpy(state->fileNames[i], fileNames[i], length + 1);
+    }
+
+    batch.count = count;
+    batch.state = state;
+
+#if defined(IMAGE_BATCH_THREADS)
+    int threadCount = 4;
+#if defined(_SC_NPROCESSORS_ONLN)
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    if (processors > 0) threadCount = (int)processors;
+#endif
+    if (threadCount > MAX_IMAGE_BATCH_THREADS) threadCount = MAX_IMAGE_BATCH_THREADS;
+    if (threadCount > count) threadCount = count;
+
+    pthread_mutex_init(&state->mutex, NULL);
+    pthread_cond_init(&state->imageDone, NULL);
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        if (pthread_create(&state->threads[state->threadCount], NULL, ImageBatchThread, state) == 0) state->threadCount++;
+    }
+
+    if (state->threadCount > 0)
+    {
+        TRACELOG(LOG_INFO, "IMAGE: Decoding batch of %i images on %i threads", count, state->threadCount);
+        return batch;
+    }
+
+    TRACELOG(LOG_WARNING, "IMAGE: Failed to create batch decoding threads, decoding on calling thread");
+#endif
+
+    // No worker threads available, decode all images right away
+    for (int i = 0; i < count; i++)
+    {
+        state->images[i] = LoadImage(state->fileNames[i]);
+        state->done[i] = true;
+    }
+
+    state->next = count;
+    state->doneCount = count;
+
+    return batch;
+}
+
+// Check if an image of the batch is decoded (index -1 checks all of them)
+bool IsImageBatchReady(ImageBatch batch, int index)
+{
+    bool ready = false;
+
+    if ((batch.state == NULL) || (index >= batch.count)) return false;
+
+#if defined(IMAGE_BATCH_THREADS)
+    pthread_mutex_lock(&batch.state->mutex);
+#endif
+    if (index < 0) ready = (batch.state->doneCount == batch.count);
+    else ready = batch.state->done[index];
+#if defined(IMAGE_BATCH_THREADS)
+    pthread_mutex_unlock(&batch.state->mutex);
+#endif
+
+    return ready;
+}
+
+// Get number of images of the batch already decoded
+int GetImageBatchProgress(ImageBatch batch)
+{
+    int progress = 0;
+
+    if (batch.state == NULL) return 0;
+
+#if defined(IMAGE_BATCH_THREADS)
+    pthread_mutex_lock(&batch.state->mutex);
+#endif
+    progress = batch.state->doneCount;
+#if defined(IMAGE_BATCH_THREADS)
+    pthread_mutex_unlock(&batch.state->mutex);
+#endif
+
+    return progress;
+}
+
+// Wait for an image of the batch to be decoded
+// NOTE: Returned image is owned by the batch, it is freed by UnloadImageBatch()
+Image WaitImageBatchImage(ImageBatch batch, int index)
+{
+    Image image = { 0 };
+
+    if ((batch.state == NULL) || (index < 0) || (index >= batch.count)) return image;
+
+#if defined(IMAGE_BATCH_THREADS)
+    pthread_mutex_lock(&batch.state->mutex);
+    while (!batch.state->done[index]) pthread_cond_wait(&batch.state->imageDone, &batch.state->mutex);
+    image = batch.state->images[index];
+    pthread_mutex_unlock(&batch.state->mutex);
+#else
+    image = batch.state->images[index];
+#endif
+
+    return image;
+}
+
+// Unload image batch, stops pending decodes and frees its images
+void UnloadImageBatch(ImageBatch batch)
+{
+    rImageBatch *state = batch.state;
+
+    if (state == NULL) return;
+
+#if defined(IMAGE_BATCH_THREADS)
+    // Let workers finish the image they are decoding but not pick new ones
+    pthread_mutex_lock(&state->mutex);
+    state->next = batch.count;
+    pthread_mutex_unlock(&state->mutex);
+
+    for (int i = 0; i < state->threadCount; i++) pthread_join(state->threads[i], NULL);
+
+    pthread_cond_destroy(&state->imageDone);
+    pthread_mutex_destroy(&state->mutex);
+#endif
+
+    for (int i = 0; i < batch.count; i++)
+    {
+        if (state->done[i]) UnloadImage(state->images[i]);
+        RL_FREE(state->fileNames[i]);
+    }
+
+    RL_FREE(state->fileNames);
+    RL_FREE(state->images);
+    RL_FREE(state->done);
+    RL_FREE(state);
+}
+
 // Export image data to file
 // NOTE: File format depends on fileName extension
 bool ExportImage(Image image, const char *fileName)
@@ -1017,6 +1204,106 @@ Image GenImageText(int width, int height, const char *text)
 }
 #endif      // SUPPORT_IMAGE_GENERATION
 
+// Generate image: atlas packing several images, rectangles of the images in the atlas returned in recs
+// NOTE: Atlas is R8G8B8A8 with power-of-two dimensions, padding is left empty around every image,
+// only the base mipmap level is packed and compressed images are skipped
+Image GenImageAtlas(const Image *images, int imageCount, int padding, Rectangle **recs)
+{
+    Image atlas = { 0 };
+    *recs = NULL;
+
+    if ((images == NULL) || (imageCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: No images provided to generate atlas");
+        return atlas;
+    }
+
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(imageCount*sizeof(stbrp_rect));
+    int area = 0;
+
+    for (int i = 0; i < imageCount; i++)
+    {
+        rects[i].id = i;
+        rects[i].w = images[i].width + 2*padding;
+        rects[i].h = images[i].height + 2*padding;
+        area += rects[i].w*rects[i].h;
+    }
+
+    // Start with the smallest power-of-two size that could hold all images, grow it until everything fits
+    int width = 64;
+    int height = 64;
+    while ((width*height) < area)
+    {
+        if (width <= height) width *= 2;
+        else height *= 2;
+    }
+
+    stbrp_context context = { 0 };
+    stbrp_node *nodes = NULL;
+    bool packed = false;
+
+    while (!packed && (width <= MAX_IMAGE_ATLAS_SIZE) && (height <= MAX_IMAGE_ATLAS_SIZE))
+    {
+        nodes = (stbrp_node *)RL_REALLOC(nodes, width*sizeof(stbrp_node));
+        stbrp_init_target(&context, width, height, nodes, width);
+        packed = stbrp_pack_rects(&context, rects, imageCount);
+
+        if (!packed)
+        {
+            if (width <= height) width *= 2;
+            else height *= 2;
+        }
+    }
+
+    RL_FREE(nodes);
+
+    if (!packed)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to pack %i images into a %ix%i atlas", imageCount, MAX_IMAGE_ATLAS_SIZE, MAX_IMAGE_ATLAS_SIZE);
+        RL_FREE(rects);
+        return atlas;
+    }
+
+    atlas.data = RL_CALLOC(width*height, 4);
+    atlas.width = width;
+    atlas.height = height;
+    atlas.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    atlas.mipmaps = 1;
+
+    *recs = (Rectangle *)RL_MALLOC(imageCount*sizeof(Rectangle));
+
+    for (int i = 0; i < imageCount; i++)
+    {
+        int x = rects[i].x + padding;
+        int y = rects[i].y + padding;
+
+        (*recs)[i] = (Rectangle){ (float)x, (float)y, (float)images[i].width, (float)images[i].height };
+
+        // Images not already in atlas format are converted on a copy
+        Image image = images[i];
+        if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            image = ImageCopy(images[i]);
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        }
+
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            for (int row = 0; row < image.height; row++)
+            {
+                memcpy((unsigned char *)atlas.data + ((y + row)*width + x)*4, (unsigned char *)image.data + row*image.width*4, image.width*4);
+            }
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Atlas image %i format not supported, left empty", i);
+
+        if (image.data != images[i].data) UnloadImage(image);
+    }
+
+    RL_FREE(rects);
+
+    return atlas;
+}
+
 //------------------------------------------------------------------------------------
 // Image manipulation functions
 //------------------------------------------------------------------------------------
@@ -3329,6 +3616,21 @@ Texture2D LoadTexture(const char *fileName)
     return texture;
 }
 
+// Load textures from image batch, uploaded in order as images are decoded
+// NOTE: textures array must have room for batch.count textures, images failing to load give an empty texture
+void LoadTexturesFromImageBatch(ImageBatch batch, Texture2D *textures)
+{
+    if (textures == NULL) return;
+
+    for (int i = 0; i < batch.count; i++)
+    {
+        Image image = WaitImageBatchImage(batch, i);
+
+        if (image.data != NULL) textures[i] = LoadTextureFromImage(image);
+        else textures[i] = (Texture2D){ 0 };
+    }
+}
+
 // Load a texture from image data
 // NOTE: image is not unloaded, it must be done manually
 Texture2D LoadTextureFromImage(Image image)
@@ -3349,6 +3651,27 @@ Texture2D LoadTextureFromImage(Image image)
     return texture;
 }
 
+// Load texture atlas from several images, uploaded as a single texture
+// NOTE: images are not unloaded, it must be done manually
+TextureAtlas LoadTextureAtlas(const Image *images, int imageCount, int padding)
+{
+    TextureAtlas atlas = { 0 };
+
+    Image image = GenImageAtlas(images, imageCount, padding, &atlas.recs);
+
+    if (image.data != NULL)
+    {
+        atlas.texture = LoadTextureFromImage(image);
+        atlas.recCount = imageCount;
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture atlas loaded successfully (%i images, %ix%i)", atlas.texture.id, imageCount, image.width, image.height);
+    }
+
+    UnloadImage(image);
+
+    return atlas;
+}
+
 // Load cubemap from image, multiple image cubemap layouts supported
 TextureCubemap LoadTextureCubemap(Image image, int layout)
 {
@@ -3496,6 +3819,13 @@ void UnloadTexture(Texture2D texture)
     }
 }
 
+// Unload texture atlas from GPU memory (VRAM) and its rectangles
+void UnloadTextureAtlas(TextureAtlas atlas)
+{
+    UnloadTexture(atlas.texture);
+    RL_FREE(atlas.recs);
+}
+
 // Check if a render texture is ready
 bool IsRenderTextureReady(RenderTexture2D target)
 {
@@ -4607,4 +4937,33 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+#if defined(IMAGE_BATCH_THREADS)
+// Image batch worker thread, decodes images until none is left
+static void *ImageBatchThread(void *arg)
+{
+    rImageBatch *state = (rImageBatch *)arg;
+
+    pthread_mutex_lock(&state->mutex);
+
+    while (state->next < state->count)
+    {
+        int index = state->next++;
+
+        // Decoding happens unlocked, other workers keep picking images meanwhile
+        pthread_mutex_unlock(&state->mutex);
+        Image image = LoadImage(state->fileNames[index]);
+        pthread_mutex_lock(&state->mutex);
+
+        state->images[index] = image;
+        state->done[index] = true;
+        state->doneCount++;
+        pthread_cond_broadcast(&state->imageDone);
+    }
+
+    pthread_mutex_unlock(&state->mutex);
+
+    return NULL;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -52,6 +52,15 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// Thread local storage, one instance of the variable per thread
+#if defined(_MSC_VER)
+    #define RL_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+    #define RL_THREAD_LOCAL _Thread_local
+#else
+    #define RL_THREAD_LOCAL __thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -0,0 +1,915 @@
+/*
+ * file: game.c
+ * ------------
+ * Simulation side of cat's cradle, see game.h.
+ */
+#include "game.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+/* can be defined to the name of a replacement allocator, e.g. to count allocations */
+#ifndef GAME_REALLOC
+        #define GAME_REALLOC(ptr, size) realloc(ptr, size)
+#else
+        void* GAME_REALLOC(void* ptr, size_t size);
+#endif
+#ifndef GAME_FREE
+        #define GAME_FREE(ptr) free(ptr)
+#else
+        void GAME_FREE(void* ptr);
+#endif
+
+/* enemy update kernel width, the scalar code is used for the remainder and as fallback */
+#if defined(__AVX2__)
+        #include <immintrin.h>
+        #define SIMD_WIDTH 8
+        typedef __m256 vfloat;
+        #define vf_load(p) _mm256_loadu_ps(p)
+        #define vf_store(p, a) _mm256_storeu_ps(p, a)
+        #define vf_set(x) _mm256_set1_ps(x)
+        #define vf_add(a, b) _mm256_add_ps(a, b)
+        #define vf_sub(a, b) _mm256_sub_ps(a, b)
+        #define vf_mul(a, b) _mm256_mul_ps(a, b)
+        #define vf_lt(a, b) _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+        #define vf_gt(a, b) _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+        #define vf_ge(a, b) _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+        #define vf_and(a, b) _mm256_and_ps(a, b)
+        #define vf_andnot(a, b) _mm256_andnot_ps(a, b)
+        #define vf_or(a, b) _mm256_or_ps(a, b)
+        #define vf_select(mask, a, b) _mm256_blendv_ps(b, a, mask)
+        #define vf_any(mask) _mm256_movemask_ps(mask)
+#elif defined(__SSE2__) || defined(_M_X64)
+        #include <emmintrin.h>
+        #define SIMD_WIDTH 4
+        typedef __m128 vfloat;
+        #define vf_load(p) _mm_loadu_ps(p)
+        #define vf_store(p, a) _mm_storeu_ps(p, a)
+        #define vf_set(x) _mm_set1_ps(x)
+        #define vf_add(a, b) _mm_add_ps(a, b)
+        #define vf_sub(a, b) _mm_sub_ps(a, b)
+        #define vf_mul(a, b) _mm_mul_ps(a, b)
+        #define vf_lt(a, b) _mm_cmplt_ps(a, b)
+        #define vf_gt(a, b) _mm_cmpgt_ps(a, b)
+        #define vf_ge(a, b) _mm_cmpge_ps(a, b)
+        #define vf_and(a, b) _mm_and_ps(a, b)
+        #define vf_andnot(a, b) _mm_andnot_ps(a, b)
+        #define vf_or(a, b) _mm_or_ps(a, b)
+        #define vf_select(mask, a, b) _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b))
+        #define vf_any(mask) _mm_movemask_ps(mask)
+#else
+        #define SIMD_WIDTH 1
+#endif
+
+
+void init_game(Game* game, Vector2 start, Vector2 cat_size, Vector2 enemy_size, unsigned int seed)
+{
+        memset(game, 0, sizeof(Game));
+        init_player(&game->cat, start, cat_size);
+        init_grid(&game->enemy_grid);
+        seed_rng(&game->rng, seed);
+        reset_timer(&game->wave.timer);
+        game->enemy_size = enemy_size;
+}
+
+
+void free_game(Game* game)
+{
+        free_enemy_list(&game->enemy_list);
+        free_grid(&game->enemy_grid);
+        free_player(&game->cat);
+}
+
+
+void reset_game(Game* game)
+{
+        game->wave.num = 0;
+        game->accumulator = 0;
+        free_enemy_list(&game->enemy_list);
+}
+
+
+/* advances the simulation by one tick with the player moving to target, returns true if the player got hit */
+bool update_game(Game* game, Vector2 target)
+{
+        Player* cat = &game->cat;
+
+        game->time += SIM_STEP;
+
+        spawn_enemies(&game->enemy_list, &game->wave, game->time);
+
+        player_input(cat, target);
+
+        add_interpolated_points(&cat->path, cat->prev_pos.x, cat->prev_pos.y, cat->pos.x, cat->pos.y, game->time);
+        remove_excess_points(&cat->path, MAX_PATH_POINTS);
+
+        if (has_made_loop(&cat->path)) {
+                build_enemy_grid(&game->enemy_grid, &game->enemy_list);
+                game->kills += kill_enemies_in_loop(&game->enemy_list, &game->enemy_grid, &cat->path, game->time);
+        }
+
+        remove_dead_enemies(&game->enemy_list, game->time);
+
+        update_enemies(&game->enemy_list, SIM_STEP, &game->rng);
+
+        build_enemy_grid(&game->enemy_grid, &game->enemy_list);
+        return is_player_hit(cat, &game->enemy_list, &game->enemy_grid, game->enemy_size);
+}
+
+
+/*
+ * Runs as many ticks as fit in the frame time, the player moves from its
+ * last position to target in equal steps so fast mouse movements can't
+ * skip over enemies. Game.kills tells the caller whether to play a sound.
+ */
+bool run_game(Game* game, float frame_time, Vector2 target)
+{
+        Vector2 start = game->cat.pos;
+        unsigned int steps;
+        unsigned int i;
+
+        game->kills = 0;
+        game->accumulator += fminf(frame_time, MAX_FRAME_TIME);
+        steps = game->accumulator / SIM_STEP;
+
+        for (i = 1; i <= steps; i++) {
+                float t = (float) i / steps;
+                Vector2 pos = {
+                        start.x + (target.x - start.x) * t,
+                        start.y + (target.y - start.y) * t
+                };
+                game->accumulator -= SIM_STEP;
+                if (update_game(game, pos)) {
+                        /* the ticks after the hit never run, left in they would make draw_game() extrapolate */
+                        game->accumulator = fmodf(game->accumulator, SIM_STEP);
+                        return true;
+                }
+        }
+        return false;
+}
+
+
+void spawn_enemies(EnemyList* list, EnemyWave* wave, double now)
+{
+        if (!list->capacity) {
+                init_enemy_list(list, 10);
+                start_timer(&wave->timer, now, 3.0f);
+        }
+
+        if (list->size == 0 && !wave->timer.started)
+                start_timer(&wave->timer, now, 3.0f);
+
+        if (list->size == 0 && timer_done(wave->timer, now))
+                spawn_wave(list, wave);
+}
+
+
+void spawn_wave(EnemyList* list, EnemyWave* wave)
+{
+        unsigned int enemy_count = 5 + wave->num * 5;
+        unsigned int i;
+
+        for (i = 0; i < enemy_count; i++) {
+                Enemy enemy;
+                init_enemy(&enemy);
+                add_enemy(list, enemy);
+        }
+        wave->num += 1;
+        reset_timer(&wave->timer);
+}
+
+
+void init_player(Player* player, Vector2 pos, Vector2 size)
+{
+        player->pos = pos;
+        player->prev_pos = pos;
+        player->size = size;
+        init_path(&player->path);
+}
+
+
+void free_player(Player* player)
+{
+        free_path(&player->path);
+}
+
+
+void player_input(Player* player, Vector2 target)
+{
+        player->prev_pos = player->pos;
+        player->pos = target;
+}
+
+
+void init_enemy(Enemy* enemy)
+{
+        bool left_x = randi(0, 1);
+        unsigned char gray_value = randi(180, 255);
+
+        enemy->color = (Color) { gray_value, gray_value, gray_value, 255 };
+        enemy->pos.x = (left_x) ? randi(-10, -5) : SCREEN_WIDTH + randi(5, 10);
+        enemy->pos.y = randi(-10, SCREEN_HEIGHT);
+        enemy->scale = randf(0.5f, ENEMY_MAX_SCALE);
+        enemy->dir_timer = 0.0f;
+        enemy->dir_threshold = randf(0.3f, 1.0f);
+
+        reset_timer(&enemy->death_timer);
+
+        if (enemy->pos.x < 0)
+                enemy->dir.x = 1;
+        else if (enemy->pos.x > SCREEN_WIDTH)
+                enemy->dir.x = -1;
+        else
+                enemy->dir.x = randf(-1.0f, 1.0f);
+
+        if (enemy->pos.y < 0)
+                enemy->dir.y = 1;
+        else if (enemy->pos.y > SCREEN_HEIGHT)
+                enemy->dir.y = -1;
+        else
+                enemy->dir.y = randf(-1.0f, 1.0f);
+}
+
+
+/* returns false if the enemy was already dying */
+bool kill_enemy(EnemyList* list, unsigned int index, double now)
+{
+        if (list->death_timer[index].started)
+                return false;
+        start_timer(&list->death_timer[index], now, 0.5f);
+        list->color[index] = RED;
+        list->start_alpha[index] = 255;
+        return true;
+}
+
+
+void update_enemy(EnemyList* list, unsigned int index, float delta, Rng* rng)
+{
+        float step = ENEMY_SPEED * delta;
+        const float* r;
+        float x;
+        float y;
+        float scale;
+
+        list->pos_x[index] += list->dir_x[index] * step;
+        list->pos_y[index] += list->dir_y[index] * step;
+
+        list->dir_timer[index] += delta;
+
+        if (list->dir_timer[index] < list->dir_threshold[index]) {
+                return;
+        }
+
+        r = next_randoms(rng, 3);
+        x = list->pos_x[index];
+        y = list->pos_y[index];
+        scale = list->scale[index];
+
+        if (x < -scale)
+                list->dir_x[index] = r[0];
+        else if (x > SCREEN_WIDTH + scale)
+                list->dir_x[index] = r[0] - 1.0f;
+        else if (y < -scale)
+                list->dir_y[index] = r[0];
+        else if (y > SCREEN_HEIGHT + scale)
+                list->dir_y[index] = r[0] - 1.0f;
+
+        list->dir_x[index] += (r[1] * 2.0f - 1.0f) * 0.05f;
+        list->dir_y[index] += (r[2] * 2.0f - 1.0f) * 0.05f;
+
+        list->dir_timer[index] = 0.0f;
+}
+
+
+/*
+ * Same as update_enemy() for SIMD_WIDTH enemies at a time. A group only
+ * takes random numbers when one of its enemies is due for a direction change.
+ */
+void update_enemies(EnemyList* list, float delta, Rng* rng)
+{
+        unsigned int i = 0;
+
+        memcpy(list->prev_x, list->pos_x, list->size * sizeof(float));
+        memcpy(list->prev_y, list->pos_y, list->size * sizeof(float));
+
+#if SIMD_WIDTH > 1
+        vfloat step = vf_set(ENEMY_SPEED * delta);
+        vfloat dt = vf_set(delta);
+        vfloat zero = vf_set(0.0f);
+        vfloat one = vf_set(1.0f);
+        vfloat two = vf_set(2.0f);
+        vfloat jitter = vf_set(0.05f);
+        vfloat width = vf_set(SCREEN_WIDTH);
+        vfloat height = vf_set(SCREEN_HEIGHT);
+
+        for (; i + SIMD_WIDTH <= list->size; i += SIMD_WIDTH) {
+                vfloat dir_x = vf_load(&list->dir_x[i]);
+                vfloat dir_y = vf_load(&list->dir_y[i]);
+                vfloat x = vf_add(vf_load(&list->pos_x[i]), vf_mul(dir_x, step));
+                vfloat y = vf_add(vf_load(&list->pos_y[i]), vf_mul(dir_y, step));
+                vfloat timer = vf_add(vf_load(&list->dir_timer[i]), dt);
+                vfloat turn = vf_ge(timer, vf_load(&list->dir_threshold[i]));
+
+                vf_store(&list->pos_x[i], x);
+                vf_store(&list->pos_y[i], y);
+
+                if (vf_any(turn)) {
+                        const float* r = next_randoms(rng, 3 * SIMD_WIDTH);
+                        vfloat r_edge = vf_load(r);
+                        vfloat r_x = vf_load(r + SIMD_WIDTH);
+                        vfloat r_y = vf_load(r + 2 * SIMD_WIDTH);
+                        vfloat scale = vf_load(&list->scale[i]);
+                        vfloat left = vf_lt(x, vf_sub(zero, scale));
+                        vfloat right = vf_andnot(left, vf_gt(x, vf_add(width, scale)));
+                        vfloat side = vf_or(left, right);
+                        vfloat top = vf_andnot(side, vf_lt(y, vf_sub(zero, scale)));
+                        vfloat bottom = vf_andnot(vf_or(side, top), vf_gt(y, vf_add(height, scale)));
+                        vfloat new_x = vf_select(left, r_edge, vf_select(right, vf_sub(r_edge, one), dir_x));
+                        vfloat new_y = vf_select(top, r_edge, vf_select(bottom, vf_sub(r_edge, one), dir_y));
+
+                        new_x = vf_add(new_x, vf_mul(vf_sub(vf_mul(r_x, two), one), jitter));
+                        new_y = vf_add(new_y, vf_mul(vf_sub(vf_mul(r_y, two), one), jitter));
+
+                        vf_store(&list->dir_x[i], vf_select(turn, new_x, dir_x));
+                        vf_store(&list->dir_y[i], vf_select(turn, new_y, dir_y));
+                        timer = vf_select(turn, zero, timer);
+                }
+                vf_store(&list->dir_timer[i], timer);
+        }
+#endif
+
+        for (; i < list->size; i++) {
+                update_enemy(list, i, delta, rng);
+        }
+}
+
+
+void init_enemy_list(EnemyList* list, unsigned int initial_capacity)
+{
+        memset(list, 0, sizeof(EnemyList));
+        resize_enemy_list(list, initial_capacity);
+}
+
+
+void resize_enemy_list(EnemyList* list, unsigned int capacity)
+{
+        list->pos_x = GAME_REALLOC(list->pos_x, capacity * sizeof(float));
+        list->pos_y = GAME_REALLOC(list->pos_y, capacity * sizeof(float));
+        list->prev_x = GAME_REALLOC(list->prev_x, capacity * sizeof(float));
+        list->prev_y = GAME_REALLOC(list->prev_y, capacity * sizeof(float));
+        list->dir_x = GAME_REALLOC(list->dir_x, capacity * sizeof(float));
+        list->dir_y = GAME_REALLOC(list->dir_y, capacity * sizeof(float));
+        list->dir_timer = GAME_REALLOC(list->dir_timer, capacity * sizeof(float));
+        list->dir_threshold = GAME_REALLOC(list->dir_threshold, capacity * sizeof(float));
+        list->scale = GAME_REALLOC(list->scale, capacity * sizeof(float));
+        list->color = GAME_REALLOC(list->color, capacity * sizeof(Color));
+        list->death_timer = GAME_REALLOC(list->death_timer, capacity * sizeof(Timer));
+        list->start_alpha = GAME_REALLOC(list->start_alpha, capacity * sizeof(unsigned char));
+        if (!list->pos_x || !list->pos_y || !list->prev_x || !list->prev_y || !list->dir_x || !list->dir_y
+        || !list->dir_timer || !list->dir_threshold || !list->scale
+        || !list->color || !list->death_timer || !list->start_alpha) {
+                fprintf(stderr, "Failed to allocate memory\n");
+                exit(1);
+        }
+        list->capacity = capacity;
+}
+
+
+void add_enemy(EnemyList* list, Enemy enemy)
+{
+        unsigned int i = list->size;
+
+        if (list->size == list->capacity)
+                resize_enemy_list(list, list->capacity * 2);
+
+        list->pos_x[i] = enemy.pos.x;
+        list->pos_y[i] = enemy.pos.y;
+        list->prev_x[i] = enemy.pos.x;
+        list->prev_y[i] = enemy.pos.y;
+        list->dir_x[i] = enemy.dir.x;
+        list->dir_y[i] = enemy.dir.y;
+        list->dir_timer[i] = enemy.dir_timer;
+        list->dir_threshold[i] = enemy.dir_threshold;
+        list->scale[i] = enemy.scale;
+        list->color[i] = enemy.color;
+        list->death_timer[i] = enemy.death_timer;
+        list->start_alpha[i] = enemy.start_alpha;
+        list->size++;
+}
+
+
+void move_enemy(EnemyList* list, unsigned int to, unsigned int from)
+{
+        list->pos_x[to] = list->pos_x[from];
+        list->pos_y[to] = list->pos_y[from];
+        list->prev_x[to] = list->prev_x[from];
+        list->prev_y[to] = list->prev_y[from];
+        list->dir_x[to] = list->dir_x[from];
+        list->dir_y[to] = list->dir_y[from];
+        list->dir_timer[to] = list->dir_timer[from];
+        list->dir_threshold[to] = list->dir_threshold[from];
+        list->scale[to] = list->scale[from];
+        list->color[to] = list->color[from];
+        list->death_timer[to] = list->death_timer[from];
+        list->start_alpha[to] = list->start_alpha[from];
+}
+
+
+/* compacts the list in a single pass, the survivors keep their (draw) order */
+void remove_dead_enemies(EnemyList* list, double now)
+{
+        unsigned int kept = 0;
+        unsigned int i;
+        for (i = 0; i < list->size; i++) {
+                if (timer_done(list->death_timer[i], now))
+                        continue;
+                if (kept != i)
+                        move_enemy(list, kept, i);
+                kept++;
+        }
+        list->size = kept;
+}
+
+
+void free_enemy_list(EnemyList* list)
+{
+        GAME_FREE(list->pos_x);
+        GAME_FREE(list->pos_y);
+        GAME_FREE(list->prev_x);
+        GAME_FREE(list->prev_y);
+        GAME_FREE(list->dir_x);
+        GAME_FREE(list->dir_y);
+        GAME_FREE(list->dir_timer);
+        GAME_FREE(list->dir_threshold);
+        GAME_FREE(list->scale);
+        GAME_FREE(list->color);
+        GAME_FREE(list->death_timer);
+        GAME_FREE(list->start_alpha);
+        memset(list, 0, sizeof(EnemyList));
+}
+
+
+void init_path(Path* path)
+{
+        path->head = 0;
+        path->size = 0;
+        path->next_segment = 0;
+        path->loop_start = 0;
+        path->has_crossing = false;
+        init_grid(&path->segments);
+}
+
+
+void free_path(Path* path)
+{
+        path->size = 0;
+        free_grid(&path->segments);
+}
+
+
+void build_enemy_grid(Grid* grid, EnemyList* list)
+{
+        unsigned int i;
+
+        clear_grid(grid);
+        for (i = 0; i < list->size; i++) {
+                Rectangle area = { list->pos_x[i], list->pos_y[i], 0, 0 };
+                int x, y;
+                grid_cell_range(area, &x, &y, &x, &y);
+                add_index(&grid->cells[y * GRID_COLS + x], i);
+        }
+}
+
+
+/* an enemy outside of the bounding box of the loop can't be inside of it */
+unsigned int kill_enemies_in_loop(EnemyList* list, Grid* grid, Path* path, double now)
+{
+        unsigned int kills = 0;
+        int x0, y0, x1, y1;
+        int x, y;
+        unsigned int k;
+
+        grid_cell_range(get_path_bounds(path), &x0, &y0, &x1, &y1);
+        for (y = y0; y <= y1; y++) {
+                for (x = x0; x <= x1; x++) {
+                        IndexList* cell = &grid->cells[y * GRID_COLS + x];
+                        for (k = 0; k < cell->size; k++) {
+                                unsigned int index = cell->items[k];
+                                Vector2 pos = { list->pos_x[index], list->pos_y[index] };
+                                if (is_in_loop(pos, path) && kill_enemy(list, index, now))
+                                        kills++;
+                        }
+                }
+        }
+        return kills;
+}
+
+
+Point* get_point(Path* path, unsigned int index)
+{
+        return &path->points[index & (PATH_CAPACITY - 1)];
+}
+
+
+/* once the buffer is full the oldest point gets overwritten */
+void add_point(Path* path, Vector2 pos, float timestamp)
+{
+        Point* point = get_point(path, path->head + path->size);
+
+        point->pos = pos;
+        point->timestamp = timestamp;
+        point->radius = POINT_RADIUS;
+
+        if (path->size == PATH_CAPACITY)
+                path->head++;
+        else
+                path->size++;
+}
+
+
+void add_interpolated_points(Path* path, float x1, float y1, float x2, float y2, float timestamp)
+{
+        float dx = x2 - x1;
+        float dy = y2 - y1;
+
+        float dist = sqrtf(dx * dx + dy * dy);
+
+        if (dist >= POINT_RADIUS * 2) {
+                unsigned int n = (unsigned int) dist;
+                unsigned int i;
+                for (i = 0; i <= n; i++) {
+                        float t = (float) i / n;
+                        float x = x1 + t * dx;
+                        float y = y1 + t * dy;
+                        Vector2 pos = {x, y};
+                        add_point(path, pos, timestamp);
+                }
+        }
+        else {
+                Vector2 pos = {x2, y2};
+                add_point(path, pos, timestamp);
+        }
+}
+
+
+void remove_excess_points(Path* path, unsigned int max_points)
+{
+        if (path->size > max_points) {
+                path->head += path->size - max_points;
+                path->size = max_points;
+        }
+}
+
+
+bool line_segments_intersect(LineSegment* a, LineSegment* b)
+{
+        float denominator = ((b->end.pos.y - b->start.pos.y) * (a->end.pos.x - a->start.pos.x))
+                          - ((b->end.pos.x - b->start.pos.x) * (a->end.pos.y - a->start.pos.y));
+        if (denominator == 0.0f) {
+                return false;
+        }
+
+        float numerator1 = ((b->start.pos.x - a->start.pos.x) * (a->end.pos.y - a->start.pos.y))
+                         - ((b->start.pos.y - a->start.pos.y) * (a->end.pos.x - a->start.pos.x));
+        float numerator2 = ((a->start.pos.y - b->start.pos.y) * (b->end.pos.x - b->start.pos.x))
+                         - ((a->start.pos.x - b->start.pos.x) * (b->end.pos.y - b->start.pos.y));
+
+        if (numerator1 == 0.0f || numerator2 == 0.0f) {
+                return false;
+        }
+
+        float r = numerator1 / denominator;
+        float s = numerator2 / denominator;
+
+        return (r > 0 && r < 1) && (s > 0 && s < 1);
+}
+
+
+/*
+ * Tests a new segment against the older segments sharing its grid cells and
+ * then adds it to the grid. Only the newest crossing matters: the path has a
+ * loop for as long as the older segment of that crossing hasn't been trimmed,
+ * which has_made_loop() checks before indexing new segments.
+ */
+void index_segment(Path* path, unsigned int segment)
+{
+        LineSegment line = { *get_point(path, segment), *get_point(path, segment + 1) };
+        Rectangle bounds = {
+                fminf(line.start.pos.x, line.end.pos.x),
+                fminf(line.start.pos.y, line.end.pos.y),
+                fabsf(line.end.pos.x - line.start.pos.x),
+                fabsf(line.end.pos.y - line.start.pos.y)
+        };
+        int x0, y0, x1, y1;
+        int x, y;
+
+        grid_cell_range(bounds, &x0, &y0, &x1, &y1);
+        for (y = y0; y <= y1; y++) {
+                for (x = x0; x <= x1; x++) {
+                        IndexList* cell = &path->segments.cells[y * GRID_COLS + x];
+                        unsigned int kept = 0;
+                        unsigned int k;
+
+                        for (k = 0; k < cell->size; k++) {
+                                unsigned int other = cell->items[k];
+
+                                /* drop segments that were trimmed off the path */
+                                if (other - path->head >= path->size)
+                                        continue;
+                                cell->items[kept++] = other;
+
+                                if (segment - other < 2)
+                                        continue;
+                                if (path->has_crossing && other - path->head <= path->loop_start - path->head)
+                                        continue;
+
+                                LineSegment other_line = { *get_point(path, other), *get_point(path, other + 1) };
+                                if (line_segments_intersect(&other_line, &line)) {
+                                        path->loop_start = other;
+                                        path->has_crossing = true;
+                                }
+                        }
+                        cell->size = kept;
+                        add_index(cell, segment);
+                }
+        }
+}
+
+
+bool has_made_loop(Path* path)
+{
+        unsigned int last_segment;
+
+        if (path->size < 2) {
+                return false;
+        }
+
+        /* segments trimmed before they were indexed never need to be tested */
+        if (path->next_segment - path->head > path->size)
+                path->next_segment = path->head;
+        if (path->has_crossing && path->loop_start - path->head >= path->size)
+                path->has_crossing = false;
+
+        last_segment = path->head + path->size - 2;
+        while (path->next_segment - path->head <= last_segment - path->head) {
+                index_segment(path, path->next_segment);
+                path->next_segment++;
+        }
+
+        return path->has_crossing;
+}
+
+
+bool is_in_loop(Vector2 pos, Path* path)
+{
+        bool result = false;
+        unsigned int j = path->size - 1;
+        unsigned int i;
+        for (i = 0; i < path->size; i++) {
+                Vector2 a = get_point(path, path->head + i)->pos;
+                Vector2 b = get_point(path, path->head + j)->pos;
+                if ((a.y < pos.y && b.y >= pos.y) || (b.y < pos.y && a.y >= pos.y)) {
+                        if (a.x + (pos.y - a.y) / (b.y - a.y) * (b.x - a.x) < pos.x)
+                                result = !result;
+                }
+                j = i;
+        }
+        return result;
+}
+
+
+Rectangle get_path_bounds(Path* path)
+{
+        Vector2 min = get_point(path, path->head)->pos;
+        Vector2 max = min;
+        unsigned int i;
+
+        for (i = 1; i < path->size; i++) {
+                Vector2 pos = get_point(path, path->head + i)->pos;
+                min.x = fminf(min.x, pos.x);
+                min.y = fminf(min.y, pos.y);
+                max.x = fmaxf(max.x, pos.x);
+                max.y = fmaxf(max.y, pos.y);
+        }
+        return (Rectangle) { min.x, min.y, max.x - min.x, max.y - min.y };
+}
+
+
+/* timer */
+void start_timer(Timer* timer, double now, double lifetime)
+{
+        timer->start_time = now;
+        timer->life_time = lifetime;
+        timer->started = true;
+}
+
+
+void reset_timer(Timer* timer)
+{
+        timer->start_time = 0;
+        timer->life_time = 0;
+        timer->started = false;
+}
+
+
+bool timer_done(Timer timer, double now)
+{
+        return (now - timer.start_time >= timer.life_time) && (timer.started);
+}
+
+
+double get_remaining_time(Timer timer, double now)
+{
+        double elapsed_time = now - timer.start_time;
+        double remaining_time = timer.life_time - elapsed_time;
+        return remaining_time > 0 ? remaining_time : 0;
+}
+
+
+/* grid */
+/* cells start with some room so the first visit to a cell doesn't allocate */
+void init_grid(Grid* grid)
+{
+        unsigned int i;
+
+        memset(grid, 0, sizeof(Grid));
+        for (i = 0; i < GRID_COLS * GRID_ROWS; i++) {
+                grid->cells[i].items = GAME_REALLOC(NULL, GRID_CELL_CAPACITY * sizeof(unsigned int));
+                if (!grid->cells[i].items) {
+                        fprintf(stderr, "Memory Allocation Failed.\n");
+                        exit(1);
+                }
+                grid->cells[i].capacity = GRID_CELL_CAPACITY;
+        }
+}
+
+
+void free_grid(Grid* grid)
+{
+        unsigned int i;
+        for (i = 0; i < GRID_COLS * GRID_ROWS; i++) {
+                GAME_FREE(grid->cells[i].items);
+        }
+        memset(grid, 0, sizeof(Grid));
+}
+
+
+/* keeps the cell allocations around so rebuilding the grid every frame doesn't allocate */
+void clear_grid(Grid* grid)
+{
+        unsigned int i;
+        for (i = 0; i < GRID_COLS * GRID_ROWS; i++) {
+                grid->cells[i].size = 0;
+        }
+}
+
+
+int grid_coord(float pos, int cells)
+{
+        return fminf(fmaxf(floorf(pos / GRID_CELL_SIZE), 0), cells - 1);
+}
+
+
+void grid_cell_range(Rectangle area, int* x0, int* y0, int* x1, int* y1)
+{
+        *x0 = grid_coord(area.x, GRID_COLS);
+        *y0 = grid_coord(area.y, GRID_ROWS);
+        *x1 = grid_coord(area.x + area.width, GRID_COLS);
+        *y1 = grid_coord(area.y + area.height, GRID_ROWS);
+}
+
+
+void add_index(IndexList* list, unsigned int index)
+{
+        if (list->size >= list->capacity) {
+                list->capacity = (list->capacity) ? list->capacity * 2 : GRID_CELL_CAPACITY;
+                list->items = GAME_REALLOC(list->items, list->capacity * sizeof(unsigned int));
+                if (!list->items) {
+                        fprintf(stderr, "Memory Allocation Failed.\n");
+                        exit(1);
+                }
+        }
+        list->items[list->size++] = index;
+}
+
+
+bool is_enemy_collision(Player* player, EnemyList* list, unsigned int index, Vector2 enemy_size)
+{
+        if (list->death_timer[index].started)
+                return false;
+        Rectangle player_rect = {
+                player->pos.x,
+                player->pos.y,
+                player->size.x * 0.5f,
+                player->size.y * 0.5f
+        };
+
+        Rectangle enemy_rect = {
+                list->pos_x[index],
+                list->pos_y[index],
+                (enemy_size.x * list->scale[index]) * 0.5f,
+                (enemy_size.y * list->scale[index]) * 0.5f
+        };
+
+        /* same test as CheckCollisionRecs(), which would pull in all of raylib */
+        return player_rect.x < enemy_rect.x + enemy_rect.width
+            && player_rect.x + player_rect.width > enemy_rect.x
+            && player_rect.y < enemy_rect.y + enemy_rect.height
+            && player_rect.y + player_rect.height > enemy_rect.y;
+}
+
+
+/*
+ * Enemy rectangles start at the enemy position, so only enemies up to one
+ * enemy size to the left of / above the player rectangle can touch it.
+ */
+bool is_player_hit(Player* player, EnemyList* list, Grid* grid, Vector2 enemy_size)
+{
+        float reach_x = enemy_size.x * ENEMY_MAX_SCALE * 0.5f;
+        float reach_y = enemy_size.y * ENEMY_MAX_SCALE * 0.5f;
+        Rectangle area = {
+                player->pos.x - reach_x,
+                player->pos.y - reach_y,
+                player->size.x * 0.5f + reach_x,
+                player->size.y * 0.5f + reach_y
+        };
+        int x0, y0, x1, y1;
+        int x, y;
+        unsigned int k;
+
+        grid_cell_range(area, &x0, &y0, &x1, &y1);
+        for (y = y0; y <= y1; y++) {
+                for (x = x0; x <= x1; x++) {
+                        IndexList* cell = &grid->cells[y * GRID_COLS + x];
+                        for (k = 0; k < cell->size; k++) {
+                                if (is_enemy_collision(player, list, cell->items[k], enemy_size))
+                                        return true;
+                        }
+                }
+        }
+        return false;
+}
+
+
+float randf(float min, float max)
+{
+        float r = ((float) rand()) / (float) RAND_MAX;
+        float diff = max - min;
+        return (min + (r * diff));
+}
+
+
+/* same distribution as GetRandomValue() */
+int randi(int min, int max)
+{
+        if (min > max) {
+                int tmp = max;
+                max = min;
+                min = tmp;
+        }
+        return (rand() % (abs(max - min) + 1) + min);
+}
+
+
+void seed_rng(Rng* rng, unsigned int seed)
+{
+        unsigned int i;
+        for (i = 0; i < RNG_LANES; i++) {
+                /* xorshift gets stuck on a zero state */
+                seed = seed * 1664525u + 1013904223u;
+                rng->state[i] = seed ? seed : 1;
+        }
+        fill_rng(rng);
+}
+
+
+/* the lanes are independent so the compiler can vectorize the inner loop */
+void fill_rng(Rng* rng)
+{
+        unsigned int i;
+        unsigned int j;
+        for (i = 0; i < RNG_BATCH; i += RNG_LANES) {
+                for (j = 0; j < RNG_LANES; j++) {
+                        unsigned int x = rng->state[j];
+                        x ^= x << 13;
+                        x ^= x >> 17;
+                        x ^= x << 5;
+                        rng->state[j] = x;
+                        rng->values[i + j] = (x >> 8) * (1.0f / 16777216.0f);
+                }
+        }
+        rng->next = 0;
+}
+
+
+/* returns count consecutive random numbers, count can't be more than RNG_BATCH */
+const float* next_randoms(Rng* rng, unsigned int count)
+{
+        const float* values;
+        if (rng->next + count > RNG_BATCH)
+                fill_rng(rng);
+        values = &rng->values[rng->next];
+        rng->next += count;
+        return values;
+}
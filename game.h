@@ -0,0 +1,202 @@
+/*
+ * file: game.h
+ * ------------
+ * Simulation side of cat's cradle: the cat's trail, the enemies and the
+ * waves. Only raylib's types are used here, so the simulation can be built
+ * and run without raylib (see bench/headless.c).
+ */
+#ifndef GAME_H
+#define GAME_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+#define POINT_RADIUS 3.0f
+#define MAX_PATH_POINTS 600
+#define PATH_CAPACITY 1024 /* must be a power of two */
+#define GRID_CELL_SIZE 25
+#define GRID_COLS (SCREEN_WIDTH / GRID_CELL_SIZE)
+#define GRID_ROWS (SCREEN_HEIGHT / GRID_CELL_SIZE)
+#define GRID_CELL_CAPACITY 32
+#define ENEMY_MAX_SCALE 1.2f
+#define ENEMY_SPEED 100.0f
+#define RNG_LANES 8
+#define RNG_BATCH 256
+#define SIM_RATE 120
+#define SIM_STEP (1.0 / SIM_RATE)
+#define MAX_FRAME_TIME 0.25f
+
+typedef struct {
+        double start_time;
+        double life_time;
+        bool started;
+} Timer;
+
+typedef struct {
+        Vector2 pos;
+        float timestamp;
+        float radius;
+} Point;
+
+typedef struct {
+        unsigned int* items;
+        unsigned int size;
+        unsigned int capacity;
+} IndexList;
+
+/* uniform grid over the playfield, positions outside of it are clamped to the border cells */
+typedef struct {
+        IndexList cells[GRID_COLS * GRID_ROWS];
+} Grid;
+
+/*
+ * Circular buffer of the newest PATH_CAPACITY points. Points are addressed
+ * by an absolute index that keeps counting up, the slot is the index masked
+ * by the capacity. Segments are identified by the index of their first
+ * point, so the indices stored in the grid stay valid when points are
+ * trimmed. Index comparisons are done on differences to survive wrap around.
+ */
+typedef struct {
+        Point points[PATH_CAPACITY];
+        unsigned int head;         /* absolute index of the oldest point */
+        unsigned int size;
+        unsigned int next_segment; /* absolute index of the first segment not yet indexed */
+        unsigned int loop_start;   /* older segment of the newest crossing found */
+        bool has_crossing;
+        Grid segments;
+} Path;
+
+typedef struct {
+        Point start;
+        Point end;
+} LineSegment;
+
+typedef struct {
+        Vector2 pos;
+        Vector2 prev_pos; /* position at the previous tick, for interpolation */
+        Vector2 size;     /* size of the sprite, the hitbox is half of it */
+        Path path;
+} Player;
+
+typedef struct {
+        Vector2 pos;
+        Vector2 dir;
+        float scale;
+        float dir_timer;
+        float dir_threshold;
+        Color color;
+        Timer death_timer;
+        unsigned char start_alpha;
+} Enemy;
+
+/*
+ * Structure of arrays, the fields update_enemies() touches every tick are
+ * kept apart from the ones only needed for drawing and dying.
+ */
+typedef struct {
+        float* pos_x;
+        float* pos_y;
+        float* prev_x;
+        float* prev_y;
+        float* dir_x;
+        float* dir_y;
+        float* dir_timer;
+        float* dir_threshold;
+        float* scale;
+        Color* color;
+        Timer* death_timer;
+        unsigned char* start_alpha;
+        unsigned int size;
+        unsigned int capacity;
+} EnemyList;
+
+/* xorshift lanes generating random floats in [0, 1) a batch at a time */
+typedef struct {
+        unsigned int state[RNG_LANES];
+        float values[RNG_BATCH];
+        unsigned int next;
+} Rng;
+
+typedef struct {
+        unsigned int num;
+        Timer timer;
+} EnemyWave;
+
+/*
+ * The simulation runs in fixed SIM_STEP ticks on its own clock, independent
+ * of the frame rate. Rendering interpolates between the last two ticks.
+ * Nothing in here needs a window or an audio device.
+ */
+typedef struct {
+        Player cat;
+        EnemyList enemy_list;
+        Grid enemy_grid;
+        EnemyWave wave;
+        Rng rng;
+        Vector2 enemy_size;  /* size of the enemy sprite at scale 1 */
+        double time;         /* simulation clock, timers run on it instead of GetTime() */
+        double accumulator;  /* frame time that hasn't been simulated yet */
+        unsigned int kills;  /* enemies killed by the last run_game() */
+} Game;
+
+void init_game(Game* game, Vector2 start, Vector2 cat_size, Vector2 enemy_size, unsigned int seed);
+void free_game(Game* game);
+void reset_game(Game* game);
+bool update_game(Game* game, Vector2 target);
+bool run_game(Game* game, float frame_time, Vector2 target);
+
+void spawn_enemies(EnemyList* list, EnemyWave* wave, double now);
+void spawn_wave(EnemyList* list, EnemyWave* wave);
+
+void init_player(Player* player, Vector2 pos, Vector2 size);
+void free_player(Player* player);
+void player_input(Player* player, Vector2 target);
+
+void init_enemy(Enemy* enemy);
+bool kill_enemy(EnemyList* list, unsigned int index, double now);
+void update_enemy(EnemyList* list, unsigned int index, float delta, Rng* rng);
+void update_enemies(EnemyList* list, float delta, Rng* rng);
+void init_enemy_list(EnemyList* list, unsigned int initial_capacity);
+void resize_enemy_list(EnemyList* list, unsigned int capacity);
+void add_enemy(EnemyList* list, Enemy enemy);
+void move_enemy(EnemyList* list, unsigned int to, unsigned int from);
+void remove_dead_enemies(EnemyList* list, double now);
+void free_enemy_list(EnemyList* list);
+void build_enemy_grid(Grid* grid, EnemyList* list);
+unsigned int kill_enemies_in_loop(EnemyList* list, Grid* grid, Path* path, double now);
+
+void init_path(Path* path);
+void free_path(Path* path);
+Point* get_point(Path* path, unsigned int index);
+void add_point(Path* path, Vector2 pos, float timestamp);
+void add_interpolated_points(Path* path, float x1, float y1, float x2, float y2, float timestamp);
+void remove_excess_points(Path* path, unsigned int max_points);
+bool line_segments_intersect(LineSegment* a, LineSegment* b);
+void index_segment(Path* path, unsigned int segment);
+bool has_made_loop(Path* path);
+bool is_in_loop(Vector2 pos, Path* path);
+Rectangle get_path_bounds(Path* path);
+
+void start_timer(Timer* timer, double now, double lifetime);
+void reset_timer(Timer* timer);
+bool timer_done(Timer timer, double now);
+double get_remaining_time(Timer timer, double now);
+
+void init_grid(Grid* grid);
+void free_grid(Grid* grid);
+void clear_grid(Grid* grid);
+int grid_coord(float pos, int cells);
+void grid_cell_range(Rectangle area, int* x0, int* y0, int* x1, int* y1);
+void add_index(IndexList* list, unsigned int index);
+
+bool is_enemy_collision(Player* player, EnemyList* list, unsigned int index, Vector2 enemy_size);
+bool is_player_hit(Player* player, EnemyList* list, Grid* grid, Vector2 enemy_size);
+float randf(float min, float max);
+int randi(int min, int max);
+void seed_rng(Rng* rng, unsigned int seed);
+void fill_rng(Rng* rng);
+const float* next_randoms(Rng* rng, unsigned int count);
+
+#endif
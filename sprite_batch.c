@@ -0,0 +1,201 @@
+/*
+ * file: sprite_batch.c
+ * --------------------
+ * Instanced sprite drawing on top of rlgl, see sprite_batch.h.
+ */
+#include "sprite_batch.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <math.h>
+
+static const char* sprite_vs =
+        "#version 330\n"
+        "in vec2 vertexCorner;\n"
+        "in vec2 instancePosition;\n"
+        "in vec2 instanceSize;\n"
+        "in vec4 instanceColor;\n"
+        "uniform mat4 mvp;\n"
+        "uniform vec4 source;\n"
+        "out vec2 fragTexCoord;\n"
+        "out vec4 fragColor;\n"
+        "void main()\n"
+        "{\n"
+        "    vec2 uv = vec2((instanceSize.x < 0.0) ? 1.0 - vertexCorner.x : vertexCorner.x, vertexCorner.y);\n"
+        "    fragTexCoord = source.xy + uv * source.zw;\n"
+        "    fragColor = instanceColor;\n"
+        "    gl_Position = mvp * vec4(instancePosition + vertexCorner * abs(instanceSize), 0.0, 1.0);\n"
+        "}\n";
+
+static const char* sprite_fs =
+        "#version 330\n"
+        "in vec2 fragTexCoord;\n"
+        "in vec4 fragColor;\n"
+        "uniform sampler2D texture0;\n"
+        "out vec4 finalColor;\n"
+        "void main()\n"
+        "{\n"
+        "    finalColor = texture(texture0, fragTexCoord) * fragColor;\n"
+        "}\n";
+
+/* two triangles covering the unit square */
+static const float sprite_corners[] = {
+        0, 0,  0, 1,  1, 1,
+        0, 0,  1, 1,  1, 0
+};
+
+void load_instance_buffer(SpriteBatch* batch, unsigned int capacity);
+
+
+void init_sprite_batch(SpriteBatch* batch, unsigned int initial_capacity)
+{
+        int corner_loc;
+
+        batch->sprites = malloc(initial_capacity * sizeof(Sprite));
+        if (!batch->sprites) {
+                fprintf(stderr, "Memory Allocation Failed.\n");
+                exit(1);
+        }
+        batch->size = 0;
+        batch->capacity = initial_capacity;
+        batch->gpu_capacity = 0;
+        batch->vao = 0;
+        batch->corner_vbo = 0;
+        batch->instance_vbo = 0;
+        batch->shader = 0;
+
+        /* instanced arrays are core since OpenGL 3.3 */
+        batch->instanced = rlGetVersion() == RL_OPENGL_33 || rlGetVersion() == RL_OPENGL_43;
+        if (!batch->instanced)
+                return;
+
+        batch->shader = rlLoadShaderCode(sprite_vs, sprite_fs);
+        if (!batch->shader) {
+                batch->instanced = false;
+                return;
+        }
+        batch->mvp_loc = rlGetLocationUniform(batch->shader, "mvp");
+        batch->texture_loc = rlGetLocationUniform(batch->shader, "texture0");
+        batch->source_loc = rlGetLocationUniform(batch->shader, "source");
+
+        batch->vao = rlLoadVertexArray();
+        rlEnableVertexArray(batch->vao);
+        batch->corner_vbo = rlLoadVertexBuffer(sprite_corners, sizeof(sprite_corners), false);
+        corner_loc = rlGetLocationAttrib(batch->shader, "vertexCorner");
+        rlSetVertexAttribute(corner_loc, 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(corner_loc);
+        load_instance_buffer(batch, initial_capacity);
+        rlDisableVertexArray();
+}
+
+
+void free_sprite_batch(SpriteBatch* batch)
+{
+        if (batch->instanced) {
+                rlUnloadVertexArray(batch->vao);
+                rlUnloadVertexBuffer(batch->corner_vbo);
+                rlUnloadVertexBuffer(batch->instance_vbo);
+                rlUnloadShaderProgram(batch->shader);
+        }
+        free(batch->sprites);
+        batch->sprites = NULL;
+        batch->size = 0;
+        batch->capacity = 0;
+}
+
+
+/* (re)creates the instance buffer and points the instance attributes at it, the vao must be bound */
+void load_instance_buffer(SpriteBatch* batch, unsigned int capacity)
+{
+        const char* names[] = { "instancePosition", "instanceSize", "instanceColor" };
+        int sizes[] = { 2, 2, 4 };
+        int types[] = { RL_FLOAT, RL_FLOAT, RL_UNSIGNED_BYTE };
+        size_t offsets[] = { offsetof(Sprite, pos), offsetof(Sprite, size), offsetof(Sprite, color) };
+        unsigned int i;
+
+        if (batch->instance_vbo)
+                rlUnloadVertexBuffer(batch->instance_vbo);
+        batch->instance_vbo = rlLoadVertexBuffer(NULL, capacity * sizeof(Sprite), true);
+        batch->gpu_capacity = capacity;
+
+        for (i = 0; i < 3; i++) {
+                int loc = rlGetLocationAttrib(batch->shader, names[i]);
+                rlSetVertexAttribute(loc, sizes[i], types[i], types[i] == RL_UNSIGNED_BYTE, sizeof(Sprite), (void*) offsets[i]);
+                rlSetVertexAttributeDivisor(loc, 1);
+                rlEnableVertexAttribute(loc);
+        }
+}
+
+
+void add_sprite(SpriteBatch* batch, Vector2 pos, Vector2 size, Color color)
+{
+        if (batch->size >= batch->capacity) {
+                batch->capacity = (batch->capacity) ? batch->capacity * 2 : 64;
+                batch->sprites = realloc(batch->sprites, batch->capacity * sizeof(Sprite));
+                if (!batch->sprites) {
+                        fprintf(stderr, "Memory Allocation Failed.\n");
+                        exit(1);
+                }
+        }
+        batch->sprites[batch->size].pos = pos;
+        batch->sprites[batch->size].size = size;
+        batch->sprites[batch->size].color = color;
+        batch->size++;
+}
+
+
+/* draws and clears the batch, anything drawn before through rlgl's own batch is flushed first to keep the order */
+void draw_sprite_batch(SpriteBatch* batch, Texture2D texture, Rectangle source)
+{
+        unsigned int i;
+        Matrix mvp;
+        int slot = 0;
+        float uv_source[4] = {
+                source.x / texture.width, source.y / texture.height,
+                source.width / texture.width, source.height / texture.height
+        };
+
+        if (batch->size == 0)
+                return;
+
+        if (!batch->instanced) {
+                for (i = 0; i < batch->size; i++) {
+                        Sprite* sprite = &batch->sprites[i];
+                        Rectangle flipped = source;
+                        Rectangle dest = { sprite->pos.x, sprite->pos.y, fabsf(sprite->size.x), sprite->size.y };
+                        if (sprite->size.x < 0)
+                                flipped.width = -flipped.width;
+                        DrawTexturePro(texture, flipped, dest, (Vector2) { 0, 0 }, 0, sprite->color);
+                }
+                batch->size = 0;
+                return;
+        }
+
+        rlDrawRenderBatchActive();
+
+        rlEnableVertexArray(batch->vao);
+        if (batch->size > batch->gpu_capacity) {
+                unsigned int capacity = batch->gpu_capacity;
+                while (capacity < batch->size)
+                        capacity *= 2;
+                load_instance_buffer(batch, capacity);
+        }
+        rlUpdateVertexBuffer(batch->instance_vbo, batch->sprites, batch->size * sizeof(Sprite), 0);
+
+        rlEnableShader(batch->shader);
+        mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+        rlSetUniformMatrix(batch->mvp_loc, mvp);
+        rlActiveTextureSlot(0);
+        rlEnableTexture(texture.id);
+        rlSetUniform(batch->texture_loc, &slot, RL_SHADER_UNIFORM_INT, 1);
+        rlSetUniform(batch->source_loc, uv_source, RL_SHADER_UNIFORM_VEC4, 1);
+
+        rlDrawVertexArrayInstanced(0, 6, batch->size);
+
+        rlDisableTexture();
+        rlDisableShader();
+        rlDisableVertexArray();
+        batch->size = 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * file: sprite_batch.h
+ * --------------------
+ * Draws many copies of one texture, or of one rectangle of an atlas, with a
+ * single instanced draw call. Each sprite is a rectangle and a tint, all of
+ * them are uploaded in one buffer per draw. Falls back to DrawTexturePro()
+ * when the OpenGL version has no instancing.
+ */
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+/* layout of the per instance vertex buffer */
+typedef struct {
+        Vector2 pos;  /* top left corner */
+        Vector2 size; /* a negative width flips the texture horizontally */
+        Color color;
+} Sprite;
+
+typedef struct {
+        Sprite* sprites;
+        unsigned int size;
+        unsigned int capacity;
+        unsigned int gpu_capacity; /* sprites the instance buffer can hold */
+        unsigned int vao;
+        unsigned int corner_vbo;
+        unsigned int instance_vbo;
+        unsigned int shader;
+        int mvp_loc;
+        int texture_loc;
+        int source_loc;
+        bool instanced;
+} SpriteBatch;
+
+void init_sprite_batch(SpriteBatch* batch, unsigned int initial_capacity);
+void free_sprite_batch(SpriteBatch* batch);
+void add_sprite(SpriteBatch* batch, Vector2 pos, Vector2 size, Color color);
+void draw_sprite_batch(SpriteBatch* batch, Texture2D texture, Rectangle source);
+
+#endif
@@ -0,0 +1,175 @@
+/*
+ * file: pack_assets.c
+ * -------------------
+ * Offline packer for the asset pack loaded by asset_pack.c. Images are
+ * decoded and packed into one RGBA atlas stored as "atlas", with a rectangle
+ * entry per image named after the file. Sounds are decoded to PCM and stored
+ * under their file name. Run it from the directory the asset paths are
+ * relative to.
+ *
+ * usage: cats_cradle_pack output.pack file ...
+ */
+#include "asset_pack.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_PACK_FILES 64
+#define ATLAS_PADDING 1
+#define IMAGE_EXTENSIONS ".png;.bmp;.tga;.jpg;.gif;.qoi"
+#define SOUND_EXTENSIONS ".wav;.ogg;.mp3;.flac;.qoa"
+
+typedef struct {
+        PackEntry entries[MAX_PACK_FILES + 1];
+        const void* data[MAX_PACK_FILES + 1];
+        unsigned int count;
+        unsigned int end; /* offset the next entry data goes to */
+} PackWriter;
+
+PackEntry* add_entry(PackWriter* writer, const char* name, PackEntryType type, const void* data, unsigned int size);
+bool write_pack(PackWriter* writer, const char* path);
+
+
+int main(int argc, char** argv)
+{
+        PackWriter writer;
+        Image images[MAX_PACK_FILES];
+        const char* image_names[MAX_PACK_FILES];
+        Wave waves[MAX_PACK_FILES];
+        unsigned int image_count = 0;
+        unsigned int wave_count = 0;
+        Rectangle* recs = NULL;
+        Image atlas = { 0 };
+        bool ok;
+        int i;
+
+        if (argc < 3 || argc - 2 > MAX_PACK_FILES) {
+                fprintf(stderr, "usage: %s output.pack file ...\n", argv[0]);
+                return 1;
+        }
+        SetTraceLogLevel(LOG_WARNING);
+
+        memset(&writer, 0, sizeof(writer));
+        writer.end = sizeof(PackHeader) + sizeof(writer.entries);
+
+        for (i = 2; i < argc; i++) {
+                const char* name = GetFileNameWithoutExt(argv[i]);
+                if (strlen(name) >= PACK_NAME_SIZE) {
+                        fprintf(stderr, "%s: name too long\n", argv[i]);
+                        return 1;
+                }
+                if (IsFileExtension(argv[i], IMAGE_EXTENSIONS)) {
+                        images[image_count] = LoadImage(argv[i]);
+                        if (!images[image_count].data)
+                                return 1;
+                        image_names[image_count++] = argv[i];
+                } else if (IsFileExtension(argv[i], SOUND_EXTENSIONS)) {
+                        Wave* wave = &waves[wave_count++];
+                        PackEntry* entry;
+
+                        *wave = LoadWave(argv[i]);
+                        if (!wave->data)
+                                return 1;
+                        entry = add_entry(&writer, name, PACK_WAVE, wave->data,
+                                          wave->frameCount * wave->channels * (wave->sampleSize / 8));
+                        entry->params[0] = wave->frameCount;
+                        entry->params[1] = wave->sampleRate;
+                        entry->params[2] = wave->sampleSize;
+                        entry->params[3] = wave->channels;
+                } else {
+                        fprintf(stderr, "%s: unknown asset type\n", argv[i]);
+                        return 1;
+                }
+        }
+
+        if (image_count > 0) {
+                PackEntry* entry;
+                unsigned int j;
+
+                atlas = GenImageAtlas(images, image_count, ATLAS_PADDING, &recs);
+                if (!atlas.data) {
+                        fprintf(stderr, "Texture Atlas Failed.\n");
+                        return 1;
+                }
+                entry = add_entry(&writer, "atlas", PACK_IMAGE, atlas.data,
+                                  GetPixelDataSize(atlas.width, atlas.height, atlas.format));
+                entry->params[0] = atlas.width;
+                entry->params[1] = atlas.height;
+                entry->params[2] = atlas.format;
+                entry->params[3] = atlas.mipmaps;
+
+                for (j = 0; j < image_count; j++) {
+                        entry = add_entry(&writer, GetFileNameWithoutExt(image_names[j]), PACK_RECT, NULL, 0);
+                        entry->params[0] = recs[j].x;
+                        entry->params[1] = recs[j].y;
+                        entry->params[2] = recs[j].width;
+                        entry->params[3] = recs[j].height;
+                        UnloadImage(images[j]);
+                }
+        }
+
+        ok = write_pack(&writer, argv[1]);
+        printf("%s: %u entries, %u bytes\n", argv[1], writer.count, writer.end);
+
+        for (i = 0; i < (int) wave_count; i++) {
+                UnloadWave(waves[i]);
+        }
+        UnloadImage(atlas);
+        MemFree(recs);
+        return ok ? 0 : 1;
+}
+
+
+PackEntry* add_entry(PackWriter* writer, const char* name, PackEntryType type, const void* data, unsigned int size)
+{
+        PackEntry* entry = &writer->entries[writer->count];
+
+        strncpy(entry->name, name, PACK_NAME_SIZE - 1);
+        entry->type = type;
+        entry->size = size;
+        entry->offset = 0;
+        if (size > 0) {
+                writer->end = (writer->end + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+                entry->offset = writer->end;
+                writer->end += size;
+        }
+        writer->data[writer->count++] = data;
+        return entry;
+}
+
+
+bool write_pack(PackWriter* writer, const char* path)
+{
+        PackHeader header = { PACK_MAGIC, PACK_VERSION, 0, 0 };
+        static const unsigned char zeros[PACK_ALIGNMENT] = { 0 };
+        long pos;
+        unsigned int i;
+        FILE* file = fopen(path, "wb");
+
+        if (!file) {
+                perror(path);
+                return false;
+        }
+
+        /* the table is written at full size so data offsets don't depend on the entry count */
+        header.entry_count = writer->count;
+        fwrite(&header, sizeof(header), 1, file);
+        fwrite(writer->entries, sizeof(writer->entries), 1, file);
+
+        for (i = 0; i < writer->count; i++) {
+                PackEntry* entry = &writer->entries[i];
+                if (entry->size == 0)
+                        continue;
+                pos = ftell(file);
+                fwrite(zeros, 1, entry->offset - pos, file);
+                fwrite(writer->data[i], 1, entry->size, file);
+        }
+
+        if (ferror(file)) {
+                perror(path);
+                fclose(file);
+                return false;
+        }
+        fclose(file);
+        return true;
+}